@@ -14,7 +14,8 @@ const int MULTIPLIER_TC = 10;  // for range evaluation of tree construction benc
 void BM_RealOperationTreeConstruction(benchmark::State& state, boost::real::OPERATION op) {
     for (auto i : state) {
         boost::real::real<> a ("1234567891");
-        boost::real::real<> b ("9876532198");
+        // operations between explicit numbers are folded as they are built, a placeholder is kept as a leaf
+        boost::real::real<> b = boost::real::real<>::placeholder(boost::real::real<>("9876532198"));
 
         // We keep the precision constant here because in constructing the *= tree, we would get way more digits
         // than in +=, -= trees. This should make the benchmarks more meaningful
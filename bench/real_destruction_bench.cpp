@@ -0,0 +1,39 @@
+#include <benchmark/benchmark.h>
+#include <benchmark_helpers.hpp>
+
+#include <optional>
+
+const int MIN_TREE_NODES = 1000;
+const int MAX_TREE_NODES = 1000000;
+const int MULTIPLIER_TD = 10;  // for range evaluation of tree destruction benchmarks
+
+/// benchmarks the destruction speed of the tree built by doing a op= b, n times, where n is the set of
+/// powers of MULTIPLIER_TD between MIN_TREE_NODES and MAX_TREE_NODES. b is a placeholder, so the operations
+/// are not folded: += and *= build a single operation with n operands, -= a chain of n binary nodes.
+void BM_RealOperationTreeDestruction(benchmark::State& state, boost::real::OPERATION op) {
+    for (auto i : state) {
+        state.PauseTiming();
+        std::optional<boost::real::real<>> a(boost::real::real<>("12"));
+        boost::real::real<> b = boost::real::real<>::placeholder(boost::real::real<>("34"));
+
+        for (int i = 0; i < state.range(0); i++) {
+            realOperationEq(*a,b,op);
+        }
+        state.ResumeTiming();
+
+        a.reset(); // releases the whole tree
+        state.SetComplexityN(state.range(0));
+    }
+}
+
+BENCHMARK_CAPTURE(BM_RealOperationTreeDestruction, addition, boost::real::OPERATION(boost::real::OPERATION::ADDITION))
+    ->RangeMultiplier(MULTIPLIER_TD)->Range(MIN_TREE_NODES ,MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealOperationTreeDestruction, subtraction, boost::real::OPERATION(boost::real::OPERATION::SUBTRACTION))
+    ->RangeMultiplier(MULTIPLIER_TD)->Range(MIN_TREE_NODES ,MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
+
+BENCHMARK_CAPTURE(BM_RealOperationTreeDestruction, multiplication, boost::real::OPERATION(boost::real::OPERATION::MULTIPLICATION))
+    ->RangeMultiplier(MULTIPLIER_TD)->Range(MIN_TREE_NODES ,MAX_TREE_NODES)->Unit(benchmark::kMillisecond)
+    ->Complexity();
@@ -10,7 +10,8 @@ const int MULTIPLIER_TE = 10;  // for range evaluation of tree evaluation benchm
 void BM_RealOperationTreeEvaluation(benchmark::State& state, boost::real::OPERATION op) {
     for (auto i : state) {
         boost::real::real<> a ("12");
-        boost::real::real<> b ("34");
+        // operations between explicit numbers are folded as they are built, a placeholder is kept as a leaf
+        boost::real::real<> b = boost::real::real<>::placeholder(boost::real::real<>("34"));
 
         state.PauseTiming();
         for (int i = 0; i < state.range(0); i++) {
@@ -59,8 +60,8 @@ void BM_RealOperationEvaluation(benchmark::State& state, boost::real::OPERATION
         for (int i = 0; i < state.range(0); i++) {
             tmp.push_back('3');
         }
-        boost::real::real<> b(tmp);
-        realOperationEq(a,b,op);
+        boost::real::real<> b = boost::real::real<>::placeholder(boost::real::real<>(tmp));
+        realOperationEq(a,b,op); // not folded, b is a placeholder
         state.ResumeTiming();
 
         a.get_real_itr().cend(); // force evaluation
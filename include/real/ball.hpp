@@ -0,0 +1,202 @@
+#ifndef BOOST_REAL_BALL_HPP
+#define BOOST_REAL_BALL_HPP
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+#include <real/real_exception.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Midpoint-radius representation of an approximation interval: the ball contains every
+         * number x such that |x - midpoint| <= radius.
+         *
+         * @details The midpoint is a full precision boost::real::exact_number, the radius only keeps
+         * RADIUS_DIGITS digits and is always rounded up, so it stays an upper bound of the error. A
+         * product or quotient of balls does a single full precision operation, on the midpoints, while
+         * the interval one does it for both boundaries. The error terms are computed with the short radii.
+         */
+        template <typename T = int>
+        class ball {
+            exact_number<T> _midpoint;
+            exact_number<T> _radius;
+
+            static constexpr T BASE = (std::numeric_limits<T>::max() / 4) * 2 - 1;
+
+            static bool is_zero(const exact_number<T>& x) {
+                return std::all_of(x.digits.begin(), x.digits.end(), [] (T digit) { return digit == 0; });
+            }
+
+            /// |x| rounded up to RADIUS_DIGITS digits
+            static exact_number<T> upper_short(const exact_number<T>& x) {
+                if (is_zero(x))
+                    return exact_number<T>();
+
+                exact_number<T> result = x.abs();
+                result.normalize();
+                return result.up_to(RADIUS_DIGITS, true);
+            }
+
+            /// |x| rounded down to RADIUS_DIGITS digits
+            static exact_number<T> lower_short(const exact_number<T>& x) {
+                if (is_zero(x))
+                    return exact_number<T>();
+
+                exact_number<T> result = x.abs();
+                result.normalize();
+                return result.up_to(RADIUS_DIGITS, false);
+            }
+
+            /// |x * y| rounded up to RADIUS_DIGITS digits
+            static exact_number<T> multiply_up(const exact_number<T>& x, const exact_number<T>& y) {
+                if (is_zero(x) || is_zero(y))
+                    return exact_number<T>();
+
+                return upper_short(x * y);
+            }
+
+            /// x / y rounded up to RADIUS_DIGITS digits, for x >= 0 and y > 0
+            static exact_number<T> divide_up(const exact_number<T>& x, const exact_number<T>& y) {
+                if (is_zero(x))
+                    return exact_number<T>();
+
+                exact_number<T> quotient = x;
+                quotient.divide_vector(y, RADIUS_DIGITS + 1);
+                quotient = upper_short(quotient);
+
+                // the quotient is truncated, it is raised until it bounds x / y
+                while (quotient * y < x)
+                    quotient.round_up(BASE);
+
+                return quotient;
+            }
+
+        public:
+            /// number of digits kept by the radius
+            static constexpr size_t RADIUS_DIGITS = 2;
+
+            /**
+             * @brief *default constructor*: It constructs a representation of the number zero.
+             */
+            ball() = default;
+
+            /**
+             * @brief Constructs the ball centered at midpoint, the radius is rounded up to RADIUS_DIGITS digits.
+             */
+            ball(const exact_number<T>& midpoint, const exact_number<T>& radius) :
+                _midpoint(midpoint), _radius(upper_short(radius)) {}
+
+            /**
+             * @brief Constructs the smallest ball, up to the radius rounding, that contains the interval x.
+             */
+            explicit ball(const interval<T>& x) {
+                exact_number<T> lower = x.lower_bound;
+                exact_number<T> upper = x.upper_bound;
+                lower.normalize();
+                upper.normalize();
+
+                exact_number<T> half(std::vector<T>{BASE / 2 + 1}, 0);
+                exact_number<T> half_width = multiply_up(upper_short(upper - lower), half);
+
+                _midpoint = lower + half_width;
+                _midpoint.normalize();
+                _radius = upper_short(std::max(half_width, (upper - _midpoint).abs()));
+            }
+
+            const exact_number<T>& midpoint() const {
+                return _midpoint;
+            }
+
+            const exact_number<T>& radius() const {
+                return _radius;
+            }
+
+            /**
+             * @brief Converts the ball to the interval [midpoint - radius, midpoint + radius].
+             */
+            interval<T> to_interval() const {
+                interval<T> result;
+
+                if (is_zero(_radius)) {
+                    result.lower_bound = _midpoint;
+                    result.upper_bound = _midpoint;
+                } else {
+                    result.lower_bound = _midpoint - _radius;
+                    result.upper_bound = _midpoint + _radius;
+                    result.lower_bound.normalize();
+                    result.upper_bound.normalize();
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Truncates the midpoint to precision digits. The truncation error is added to the radius.
+             */
+            ball<T> up_to(size_t precision) const {
+                exact_number<T> midpoint = _midpoint;
+                midpoint.normalize_left();
+
+                if (precision >= midpoint.digits.size())
+                    return *this;
+
+                exact_number<T> truncated = midpoint.up_to(precision, false);
+                return ball<T>(truncated, upper_short(_radius + upper_short(midpoint - truncated)));
+            }
+
+            /// @return true if the ball contains zero, or its midpoint is too close to the radius to tell it apart.
+            bool contains_zero() const {
+                return !(lower_short(_midpoint) > _radius);
+            }
+
+            ball<T> operator+(const ball<T>& other) const {
+                return ball<T>(_midpoint + other._midpoint, _radius + other._radius);
+            }
+
+            ball<T> operator-(const ball<T>& other) const {
+                return ball<T>(_midpoint - other._midpoint, _radius + other._radius);
+            }
+
+            /// (a ± r) * (b ± s) = a * b ± (|a| s + |b| r + r s)
+            ball<T> operator*(const ball<T>& other) const {
+                exact_number<T> radius = multiply_up(upper_short(_midpoint), other._radius) +
+                                         multiply_up(upper_short(other._midpoint), _radius) +
+                                         multiply_up(_radius, other._radius);
+
+                return ball<T>(_midpoint * other._midpoint, radius);
+            }
+
+            /**
+             * @brief Divides the ball by divisor. The quotient of the midpoints is calculated with
+             * maximum_precision digits, and its exact error is taken from its residual:
+             * (a ± r) / (b ± s) = q ± (|q b - a| + r + |q| s) / (|b| - s)
+             *
+             * @throws boost::real::divergent_division_result_exception if the divisor contains zero.
+             */
+            ball<T> divide(const ball<T>& divisor, size_t maximum_precision) const {
+                if (divisor.contains_zero())
+                    throw boost::real::divergent_division_result_exception();
+
+                exact_number<T> quotient = _midpoint;
+                quotient.divide_vector(divisor._midpoint, maximum_precision);
+                quotient.normalize();
+
+                exact_number<T> residual = quotient * divisor._midpoint - _midpoint;
+                exact_number<T> error = upper_short(residual) + _radius +
+                                        multiply_up(upper_short(quotient), divisor._radius);
+
+                exact_number<T> divisor_magnitude = lower_short(divisor._midpoint) - divisor._radius;
+                divisor_magnitude = lower_short(divisor_magnitude);
+
+                return ball<T>(quotient, divide_up(upper_short(error), divisor_magnitude));
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_BALL_HPP
@@ -0,0 +1,45 @@
+#ifndef BOOST_REAL_COMPARISON_HPP
+#define BOOST_REAL_COMPARISON_HPP
+
+#include <optional>
+
+#include <real/exact_number.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief The result of a three-way comparison between two boost::real::real numbers.
+         *
+         * @details UNDECIDED is returned when the approximation intervals of both numbers still
+         * overlap once the maximum precision is reached, so the order between them is unknown.
+         */
+        enum class ORDERING {LESS, EQUAL, GREATER, UNDECIDED};
+
+        /**
+         * @brief Result of a non throwing three-way comparison (see boost::real::real::try_compare).
+         *
+         * @details width is the width of the widest of both approximation intervals at the moment
+         * the comparison stopped. For an UNDECIDED ordering it tells how close both numbers are
+         * known to be.
+         */
+        template <typename T = int>
+        struct comparison_result {
+            ORDERING ordering;
+            exact_number<T> width;
+        };
+
+        /**
+         * @brief Result of a non throwing comparison predicate (see boost::real::real::try_less and
+         * boost::real::real::try_equal). value is empty if the predicate could not be decided before
+         * reaching the maximum precision.
+         */
+        template <typename T = int>
+        struct predicate_result {
+            std::optional<bool> value;
+            exact_number<T> width;
+        };
+    }
+}
+
+#endif // BOOST_REAL_COMPARISON_HPP
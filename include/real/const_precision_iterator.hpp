@@ -1,10 +1,13 @@
 #ifndef BOOST_CONST_PRECISION_ITERATOR_HPP
 #define BOOST_CONST_PRECISION_ITERATOR_HPP
 
+#include <real/ball.hpp>
 #include <real/interval.hpp>
 #include <real/real_explicit.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_operation.hpp>
+#include <real/real_placeholder.hpp>
+#include <real/real_rational.hpp>
 #include <real/exact_number.hpp>
 #include <real/real_exception.hpp>
 #include <limits>
@@ -12,16 +15,23 @@
 #include <variant>
 #include <assert.h>
 #include <iterator>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <vector>
 
 namespace boost {
     namespace real{
     /**
      * @file The const_precision_iterator provides the functionality to iterate through precision intervals
-     * of all three kinds of reals
+     * of all three kinds of reals, of the rational numbers, and of the placeholders, through the numbers
+     * bound to them
      * 
      * @note variant and visit/visitors are used extensively in this implementation
-     * @TODO: consider doing traversals to lower the demands of recursion
+     * @note operation trees are iterated and refined with explicit stacks (see operation_iterate_n_times in
+     * real_data.hpp and refine_to_width)
+     * @note the iterators owned by real_data are shared by every copy of a real and may be refined by several
+     * threads at once, each of them is guarded by the reader-writer lock of its real_data
      * @sa documention on std::variant, std::visit
      */
         template<class... Ts> struct overloaded : Ts... { using Ts::operator()...; };
@@ -29,9 +39,20 @@ namespace boost {
         // fwd decl
         template <typename T>
         class real;
+        template <typename T>
+        class parallel_evaluator;
+        template <typename T>
+        class real_data;
+        template <typename T>
+        class node_table;
+        template <typename T>
+        class real_tape;
+        template <typename T>
+        class real_batch;
 
         template <typename T>
-        using real_number = std::variant<std::monostate, real_explicit<T>, real_algorithm<T>, real_operation<T>>;
+        using real_number = std::variant<std::monostate, real_explicit<T>, real_algorithm<T>, real_operation<T>,
+                                         real_placeholder<T>, real_rational<T>>;
         using precision_t = size_t;
 
         /// the default max precision to use if the user hasn't provided one.
@@ -40,11 +61,21 @@ namespace boost {
         template <typename T>
         class const_precision_iterator {
             public:
+            using exponent_t = typename exact_number<T>::exponent_t;
+
             /**
              * @brief Optional user-provided maximum precision for all const_precision_iterators. 
              */
 
             inline static std::optional<precision_t> global_maximum_precision;
+
+            /**
+             * @brief When set, products and quotients of operation nodes are calculated in midpoint-radius
+             * (boost::real::ball) arithmetic, which does a single full precision product or division per
+             * node instead of one per boundary. The intervals are slightly wider, but still enclose the
+             * result. It should be set before any number is evaluated.
+             */
+            inline static bool ball_arithmetic = false;
             /// @TODO look into STL-style iterators
             // typedef std::forward_iterator_tag iterator_category;
             // typedef void difference_type (?);
@@ -52,6 +83,13 @@ namespace boost {
             // typedef const value_type& reference (?) not necessary because const
             // typedef const value_type* pointer
 
+            // refines the nodes of an operation tree out of order, see parallel_evaluator.hpp
+            friend class parallel_evaluator<T>;
+            // sets the lock of the iterator it owns
+            friend class real_data<T>;
+            // calculates the operations of a compiled tree with operation_boundaries()
+            friend class real_tape<T>;
+
             private:
                 /**
                  * @brief this holds a ptr to explicit number, algorithmic number, or real_operation
@@ -68,6 +106,35 @@ namespace boost {
 
                 interval<T> _approximation_interval;
 
+                /// lock of the real_data owning this iterator. Copies are never shared and have none.
+                std::shared_mutex * _mutex = nullptr;
+
+                /// the current precision, read under the shared lock of the iterator
+                precision_t current_precision() const {
+                    if (_mutex == nullptr)
+                        return _precision;
+
+                    std::shared_lock<std::shared_mutex> lock(*_mutex);
+                    return _precision;
+                }
+
+                /// a copy of the current interval, read under the shared lock of the iterator
+                interval<T> snapshot() const {
+                    if (_mutex == nullptr)
+                        return _approximation_interval;
+
+                    std::shared_lock<std::shared_mutex> lock(*_mutex);
+                    return _approximation_interval;
+                }
+
+                /// locks the iterator to refine it, the returned lock is empty if the iterator is not shared
+                std::unique_lock<std::shared_mutex> lock() const {
+                    if (_mutex == nullptr)
+                        return std::unique_lock<std::shared_mutex>();
+
+                    return std::unique_lock<std::shared_mutex>(*_mutex);
+                }
+
                 void check_and_swap_boundaries() {
                     std::visit( overloaded { // perform operation on whatever is held in variant
                         [this] (real_explicit<T>& real) { 
@@ -89,6 +156,84 @@ namespace boost {
                     }, *_real_ptr);
                 }
 
+                /// magnitude exponent used for intervals that only contain zero
+                static constexpr exponent_t ZERO_MAGNITUDE = std::numeric_limits<exponent_t>::min() / 4;
+
+                /// returns E such that every number in the interval has an absolute value lower than base^E
+                static exponent_t upper_magnitude(const interval<T>& x) {
+                    exponent_t result = ZERO_MAGNITUDE;
+                    for (exact_number<T> bound : {x.lower_bound, x.upper_bound}) {
+                        bound.normalize_left();
+                        if (!bound.digits.empty() && bound.digits.front() != 0)
+                            result = std::max(result, bound.exponent);
+                    }
+                    return result;
+                }
+
+                /// -x, zero stays positive
+                static exact_number<T> negated(exact_number<T> x) {
+                    x.normalize_left();
+                    x.positive = !x.positive || x.digits.empty() || x.digits.front() == 0;
+                    return x;
+                }
+
+                /// x * base^n, zero is left as it is
+                static exact_number<T> scaled(exact_number<T> x, exponent_t n) {
+                    x.normalize_left();
+                    if (!x.digits.empty() && x.digits.front() != 0)
+                        x.exponent += n;
+                    return x;
+                }
+
+                /// a lower bound of x / 2^halvings with at most two digits, x must be positive
+                static exact_number<T> halved(exact_number<T> x, unsigned int halvings) {
+                    const exact_number<T> half(std::vector<T>{(std::numeric_limits<T>::max() / 4)}, 0);
+                    for (unsigned int i = 0; i < halvings; i++) {
+                        x = x * half;
+                        x.normalize();
+                        x = x.up_to(2, false);
+                    }
+                    return x;
+                }
+
+                /// returns E such that every number in the interval, which must not contain zero, has an
+                /// absolute value of at least base^(E - 1)
+                static exponent_t lower_magnitude(const interval<T>& x) {
+                    exact_number<T> lower = x.lower_bound;
+                    exact_number<T> upper = x.upper_bound;
+                    lower.normalize_left();
+                    upper.normalize_left();
+                    return std::min(lower.exponent, upper.exponent);
+                }
+
+                /// refines a leaf whose first digit has the given exponent until its width is at most base^error_exponent,
+                /// or as far as the maximum precision allows. Returns false if it was already there.
+                bool refine_leaf_to(exponent_t error_exponent, exponent_t leaf_exponent, bool fully_representable) {
+                    exponent_t needed = leaf_exponent - error_exponent;
+
+                    if (!fully_representable && needed > (exponent_t)this->maximum_precision()) {
+                        if (this->_precision >= this->maximum_precision())
+                            return false;
+
+                        needed = this->maximum_precision();
+                    }
+
+                    if (needed > (exponent_t)this->_precision)
+                        this->iterate_n_times(needed - this->_precision);
+                    return true;
+                }
+
+                /// copies the interval of the number bound to a placeholder, refined at least to the current precision
+                void update_placeholder_boundaries(real_placeholder<T>& placeholder) {
+                    const_precision_iterator<T>& value = placeholder.get_value_itr();
+                    std::unique_lock<std::shared_mutex> lock = value.lock();
+
+                    if (value._precision < this->_precision)
+                        value.iterate_n_times(this->_precision - value._precision);
+
+                    this->_approximation_interval = value._approximation_interval;
+                }
+
             public:
                 /**
                  * @brief Returns the maximum allowed precision, if that precision is reached and an
@@ -122,15 +267,30 @@ namespace boost {
 
                 /**
                  * @brief *Copy constructor:* Construct a new real::const_precision_iterator
-                 * which is a copy of the other iterator.
+                 * which is a copy of the other iterator. The copy is not shared, so it does not take
+                 * the lock of the other iterator.
                  *
                  * @param other - the real::const_precision_iterator to copy.
                  */
-                const_precision_iterator(const const_precision_iterator& other) = default;
+                const_precision_iterator(const const_precision_iterator& other) :
+                    _real_ptr(other._real_ptr),
+                    _precision(other._precision),
+                    _maximum_precision(other._maximum_precision),
+                    _approximation_interval(other._approximation_interval) {}
+
+                /// copies the state of the other iterator, this iterator keeps its own lock
+                const_precision_iterator& operator=(const const_precision_iterator& other) {
+                    _real_ptr = other._real_ptr;
+                    _precision = other._precision;
+                    _maximum_precision = other._maximum_precision;
+                    _approximation_interval = other._approximation_interval;
+                    return *this;
+                }
 
 
                 // fwd decl'd. Definition found in real_data.hpp
                 void update_operation_boundaries(real_operation<T> &ro);
+                void calculate_operation_boundaries(real_operation<T> &ro);
 
                 /**
                  * @brief Constructor for the least precise precision iterator
@@ -182,6 +342,12 @@ namespace boost {
                             update_operation_boundaries(real);
                             // _maximum_precision = std::max(real.get_lhs_itr().maximum_precision(), real.get_rhs_itr().maximum_precision());
                             },
+                        [this] (real_placeholder<T>& real) {
+                            update_placeholder_boundaries(real);
+                        },
+                        [this] (real_rational<T>& real) {
+                            this->_approximation_interval = real.bounds(this->_precision);
+                        },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                             }
@@ -191,6 +357,22 @@ namespace boost {
                 // fwd decl, defined in real_data.hpp
                 void init_operation_itr(real_operation<T> &ro, bool cend);
 
+                // the interval of operation over the operand intervals lhs and rhs, calculated with the given
+                // precision. Defined in real_data.hpp
+                static interval<T> operation_boundaries(OPERATION operation, const interval<T>& lhs,
+                                                        const interval<T>& rhs, precision_t precision,
+                                                        precision_t maximum_precision);
+
+                // the interval of the n-ary operation (SUM, PRODUCT or DOT) over the operand intervals, calculated
+                // with the given precision. Defined in real_data.hpp
+                static interval<T> nary_boundaries(OPERATION operation, const std::vector<interval<T>>& operands,
+                                                   precision_t precision, precision_t maximum_precision);
+
+                // the interval of the unary operation (POWER) over the operand interval, with its exponent,
+                // calculated with the given precision. Defined in real_data.hpp
+                static interval<T> unary_boundaries(OPERATION operation, const interval<T>& operand, long exponent,
+                                                    precision_t precision, precision_t maximum_precision);
+
                 /**
                  * @brief Constructor for maximum_precision precision iterator, from real_number
                  */
@@ -209,6 +391,14 @@ namespace boost {
                                 init_operation_itr(real, true);
                                 update_operation_boundaries(real);
                             },
+                            [this, &a] (real_placeholder<T>& real) {
+                                *this = const_precision_iterator(a);
+                                this->iterate_n_times(this->maximum_precision() - 1);
+                            },
+                            [this, &a] (real_rational<T>& real) {
+                                *this = const_precision_iterator(a);
+                                this->iterate_n_times(this->maximum_precision() - 1);
+                            },
                             [] (auto & real) {
                                 throw boost::real::bad_variant_access_exception();
                             }
@@ -235,13 +425,188 @@ namespace boost {
                     return *this;
                 }
 
-                interval<T> get_interval() const {
+                const interval<T>& get_interval() const {
                     return _approximation_interval;
                 }
 
                 // fwd decl, defined in real_data.hpp
                 void operation_iterate(real_operation<T> &ro);
                 void operation_iterate_n_times(real_operation<T> &ro, int n);
+                bool iterate_operation_once(real_operation<T> &ro);
+
+                // how a node calculates its interval once the operands of a refinement step reached their
+                // budgets: it does not (it was refined in place), it copies the interval of its only operand,
+                // it calculates its interval anew, or it updates it at the precision of the step
+                enum class FINISH {NOTHING, COPY, RECALCULATE, UPDATE};
+
+                // a node being refined to max_width by refine_to_width, with the step in progress
+                struct refinement {
+                    const_precision_iterator<T>* node = nullptr;
+                    exact_number<T> max_width;
+                    // held while the node is refined, empty for the node refine_to_width was called on
+                    std::unique_lock<std::shared_mutex> lock;
+                    exponent_t slack = 0;
+
+                    // the step: the operands to refine to their budgets, then how the node finishes it
+                    bool refining = false;
+                    std::vector<std::pair<const_precision_iterator<T>*, exact_number<T>>> operands;
+                    size_t next = 0;
+                    FINISH finish = FINISH::NOTHING;
+                    exponent_t precision = 0;
+
+                    // interval of the operand refined last and highest precision of the refined operands
+                    interval<T> operand_interval;
+                    precision_t operand_precision = 0;
+                };
+
+                // defined in real_data.hpp, plans the refinement step of an operation to a width of max_width
+                bool plan_operation_refinement(real_operation<T> &ro, const exact_number<T>& max_width,
+                                               refinement& step);
+
+                // refines a leaf to a width of at most max_width, or lists in step the operands an operation
+                // or a placeholder needs refined first. Returns false if the node is at the maximum precision
+                // and cannot be refined any more.
+                bool plan_refinement(const exact_number<T>& max_width, refinement& step) {
+                    exact_number<T> budget = max_width;
+                    budget.normalize_left();
+                    // base^(error_exponent + 1) > budget >= base^error_exponent, for the leaves
+                    exponent_t error_exponent = budget.exponent - 1;
+
+                    return std::visit( overloaded { // perform operation on whatever is held in variant
+                        [this, &error_exponent] (real_explicit<T>& real) {
+                            return this->refine_leaf_to(error_exponent, real.exponent(), true);
+                        },
+                        [this, &error_exponent] (real_algorithm<T>& real) {
+                            return this->refine_leaf_to(error_exponent, real.exponent(), false);
+                        },
+                        [this, &max_width, &step] (real_operation<T>& real) {
+                            return this->plan_operation_refinement(real, max_width, step);
+                        },
+                        [&max_width, &step] (real_placeholder<T>& real) {
+                            step.operands.push_back({&real.get_value_itr(), max_width});
+                            step.finish = FINISH::COPY;
+                            return true;
+                        },
+                        [this, &error_exponent] (real_rational<T>& real) {
+                            exponent_t needed = real.exponent() - error_exponent;
+                            return this->refine_leaf_to(error_exponent, real.exponent(),
+                                                        real.exact_within(std::max<exponent_t>(needed, 0)));
+                        },
+                        [] (auto& real) -> bool {
+                            throw boost::real::bad_variant_access_exception();
+                        }
+                    }, *_real_ptr);
+                }
+
+                // calculates the interval of the node once the operands of step reached their budgets
+                void finish_refinement(const refinement& step) {
+                    switch (step.finish) {
+                        case FINISH::COPY:
+                            this->_approximation_interval = step.operand_interval;
+                            this->_precision = std::max(this->_precision, step.operand_precision);
+                            break;
+                        case FINISH::RECALCULATE:
+                            // the operand may be narrower than when the interval of this precision was cached
+                            this->_precision = std::max(this->_precision, step.operand_precision);
+                            calculate_operation_boundaries(std::get<real_operation<T>>(*_real_ptr));
+                            break;
+                        case FINISH::UPDATE:
+                            this->_precision = step.precision;
+                            update_operation_boundaries(std::get<real_operation<T>>(*_real_ptr));
+                            break;
+                        default:
+                            break;
+                    }
+                }
+
+                /**
+                 * @brief Demand-driven refinement. It refines the approximation interval until its width is
+                 * at most base^error_exponent.
+                 *
+                 * @details Instead of advancing every operand by the same amount of digits, an operation
+                 * derives the error budget of each operand from the magnitude of the operands' intervals,
+                 * refines the operands to that budget and then recomputes its own boundaries. This way,
+                 * each node of the tree is refined only as much as the requested error needs.
+                 *
+                 * @param error_exponent - the requested width is base^error_exponent.
+                 * @throws boost::real::precision_exception if the width cannot be reached without
+                 * exceeding the maximum precision.
+                 */
+                void refine_to(exponent_t error_exponent) {
+                    refine_to_width(exact_number<T>(std::vector<T>{1}, error_exponent + 1));
+                }
+
+                /**
+                 * @brief Demand-driven refinement to a width of at most max_width, which must be positive.
+                 * The budgets of the operands are exact numbers, so a binary operation only halves them
+                 * instead of taking a whole digit of the internal base from them.
+                 *
+                 * @throws boost::real::precision_exception if the width cannot be reached without
+                 * exceeding the maximum precision.
+                 */
+                void refine_to_width(const exact_number<T>& max_width) {
+                    // the nodes being refined, from this one to the operand refined last. The tree is walked
+                    // with this explicit stack instead of recursing, so its depth is only bounded by the heap.
+                    std::vector<refinement> pending;
+                    pending.emplace_back();
+                    pending.back().node = this;
+                    pending.back().max_width = max_width;
+
+                    while (!pending.empty()) {
+                        refinement& current = pending.back();
+                        const_precision_iterator<T>& node = *current.node;
+
+                        if (current.refining && current.next < current.operands.size()) {
+                            // the operand is locked until it reaches its budget
+                            refinement operand;
+                            operand.node = current.operands[current.next].first;
+                            operand.max_width = current.operands[current.next].second;
+                            operand.lock = operand.node->lock();
+                            ++current.next;
+                            pending.push_back(std::move(operand));
+                            continue;
+                        }
+
+                        if (current.refining) {
+                            node.finish_refinement(current);
+                            current.refining = false;
+                            ++current.slack;
+                            continue;
+                        }
+
+                        bool refined = node._approximation_interval.is_a_number() ||
+                                       !(current.max_width < node._approximation_interval.width());
+
+                        if (!refined) {
+                            // the budgets are estimations, if they fall short the operands are asked for one more digit
+                            current.operands.clear();
+                            current.next = 0;
+                            current.operand_precision = 0;
+                            current.finish = FINISH::NOTHING;
+
+                            if (node.plan_refinement(scaled(current.max_width, -current.slack), current)) {
+                                if (current.finish == FINISH::NOTHING)
+                                    ++current.slack;
+                                else
+                                    current.refining = true;
+                                continue;
+                            }
+
+                            // the budgets of the operands are bounds, the node that asked for this one may still
+                            // reach its own width with it. This node cannot.
+                            if (pending.size() == 1)
+                                throw boost::real::precision_exception();
+                        }
+
+                        // the node that asked for this operand reads it before it is unlocked
+                        if (pending.size() > 1) {
+                            refinement& parent = pending[pending.size() - 2];
+                            parent.operand_interval = node._approximation_interval;
+                            parent.operand_precision = std::max(parent.operand_precision, node._precision);
+                        }
+                        pending.pop_back();
+                    }
+                }
 
                 /**
                  * @brief It recalculates the approximation interval boundaries increasing the used
@@ -258,6 +623,12 @@ namespace boost {
                         [this] (real_operation<T>& real) {
                             operation_iterate_n_times(real, 1);
                         },
+                        [this] (real_placeholder<T>& real) {
+                            this->iterate_n_times(1);
+                        },
+                        [this] (real_rational<T>& real) {
+                            this->iterate_n_times(1);
+                        },
                         [] (auto& real) {
                             throw boost::real::bad_variant_access_exception();
                         }
@@ -361,6 +732,15 @@ namespace boost {
                         [this, &n] (real_operation<T>& real) {
                             operation_iterate_n_times(real, n);
                         },
+                        [this, &n] (real_placeholder<T>& real) {
+                            this->_precision += n;
+                            update_placeholder_boundaries(real);
+                        },
+                        [this, &n] (real_rational<T>& real) {
+                            // the digits are cached by the number, only the new ones are calculated
+                            this->_precision += n;
+                            this->_approximation_interval = real.bounds(this->_precision);
+                        },
                         [] (auto & real) {
                             throw boost::real::bad_variant_access_exception();
                         }
@@ -0,0 +1,251 @@
+#ifndef BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
+#define BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A double-double number: the unevaluated sum hi + lo of two doubles, where |lo| is at
+         * most half an ulp of hi. It carries about 106 bits of precision.
+         */
+        struct double_double {
+            double hi = 0;
+            double lo = 0;
+
+            double_double() = default;
+
+            double_double(double hi, double lo = 0) {
+                // the sum is exact, so the number is normalized without changing its value
+                this->hi = hi + lo;
+                double remainder = this->hi - hi;
+                this->lo = std::isfinite(this->hi) ? (hi - (this->hi - remainder)) + (lo - remainder) : 0;
+            }
+
+            /// exact x + y, as the rounded sum and its error
+            static double_double two_sum(double x, double y) {
+                double_double result;
+                result.hi = x + y;
+                double remainder = result.hi - x;
+                result.lo = (x - (result.hi - remainder)) + (y - remainder);
+                return result;
+            }
+
+            /// exact x * y, as the rounded product and its error
+            static double_double two_product(double x, double y) {
+                double_double result;
+                result.hi = x * y;
+                result.lo = std::fma(x, y, -result.hi);
+                return result;
+            }
+
+            double_double operator-() const {
+                double_double result;
+                result.hi = -hi;
+                result.lo = -lo;
+                return result;
+            }
+
+            double_double operator+(const double_double& other) const {
+                double_double high = two_sum(hi, other.hi);
+                double_double low = two_sum(lo, other.lo);
+                high.lo += low.hi;
+                high = double_double(high.hi, high.lo);
+                high.lo += low.lo;
+                return double_double(high.hi, high.lo);
+            }
+
+            double_double operator-(const double_double& other) const {
+                return *this + (-other);
+            }
+
+            double_double operator*(const double_double& other) const {
+                double_double product = two_product(hi, other.hi);
+                product.lo += hi * other.lo + lo * other.hi;
+                return double_double(product.hi, product.lo);
+            }
+
+            double_double operator/(const double_double& other) const {
+                // long division, each partial quotient adds about 53 bits
+                double first = hi / other.hi;
+                double_double remainder = *this - other * double_double(first);
+                double second = remainder.hi / other.hi;
+                remainder = remainder - other * double_double(second);
+                double third = remainder.hi / other.hi;
+
+                double_double result = double_double(first, second);
+                return result + double_double(third);
+            }
+
+            bool operator<(const double_double& other) const {
+                return hi < other.hi || (hi == other.hi && lo < other.lo);
+            }
+        };
+
+        /**
+         * @brief An interval of boost::real::double_double numbers that encloses a number. It is the
+         * second stage of the comparisons cascade, after boost::real::double_interval: it is only
+         * calculated when the double intervals of two numbers overlap.
+         *
+         * @details The double-double operations are not correctly rounded, so each result is widened by
+         * a bound of its error, 2^-98 times the magnitude of the operands, which is well above the
+         * error of the algorithms. Near the underflow that bound is replaced by 2^-998, above the few
+         * denormal ulps lost there, and magnitudes over 2^900 give the whole real line, which decides
+         * nothing.
+         */
+        struct double_double_interval {
+            double_double lower = double_double(-std::numeric_limits<double>::infinity());
+            double_double upper = double_double(std::numeric_limits<double>::infinity());
+
+            /// @brief *default constructor*: It constructs the whole real line, which decides nothing.
+            double_double_interval() = default;
+
+            double_double_interval(const double_double& lower, const double_double& upper)
+                    : lower(lower), upper(upper) {
+                if (!std::isfinite(lower.hi) || !std::isfinite(upper.hi) ||
+                    !std::isfinite(lower.lo) || !std::isfinite(upper.lo))
+                    *this = double_double_interval();
+            }
+
+            /// the interval that contains digit, which is exactly representable as a double-double
+            template <typename T>
+            static double_double_interval from_digit(T digit) {
+                double hi = (double) digit;
+                double_double value(hi, (double) (digit - (T) hi));
+                return double_double_interval(value, value);
+            }
+
+            /**
+             * @brief The interval that contains the number 0.d1d2d3... * base^exponent, given its leading
+             * digits. If the digits are truncated (more_digits), the rest of them add up to less than a
+             * unit of the last leading digit.
+             */
+            template <typename T>
+            static double_double_interval from_digits(const std::vector<T>& leading_digits, int exponent,
+                                                      bool positive, bool more_digits, T base) {
+                double_double_interval digits_base = from_digit(base);
+                double_double_interval result(0, 0);
+
+                for (T digit : leading_digits)
+                    result = result * digits_base + from_digit(digit);
+
+                if (more_digits)
+                    result = result + double_double_interval(0, 1);
+
+                result = result * power(digits_base, exponent - (int) leading_digits.size());
+
+                if (!positive)
+                    result = double_double_interval(-result.upper, -result.lower);
+
+                return result;
+            }
+
+            /// x^n with outward rounding
+            static double_double_interval power(double_double_interval x, int n) {
+                bool reciprocal = n < 0;
+                unsigned int remaining = reciprocal ? -(unsigned int) n : n;
+                double_double_interval result(1, 1);
+
+                while (remaining > 0) {
+                    if (remaining & 1)
+                        result = result * x;
+                    x = x * x;
+                    remaining >>= 1;
+                }
+
+                return reciprocal ? double_double_interval(1, 1) / result : result;
+            }
+
+            bool contains_zero() const {
+                return !(double_double(0) < lower) && !(upper < double_double(0));
+            }
+
+            /// true if every number in *this is lower than every number in other
+            bool operator<(const double_double_interval& other) const {
+                return upper < other.lower;
+            }
+
+            /// -x, exact
+            double_double_interval operator-() const {
+                return double_double_interval(-upper, -lower);
+            }
+
+            /// |x|, exact
+            double_double_interval abs() const {
+                if (!(lower < double_double(0)))
+                    return *this;
+                if (!(double_double(0) < upper))
+                    return -*this;
+                return double_double_interval(double_double(0), upper < -lower ? -lower : upper);
+            }
+
+            double_double_interval operator+(const double_double_interval& other) const {
+                double magnitude = std::max(std::abs(lower.hi) + std::abs(other.lower.hi),
+                                            std::abs(upper.hi) + std::abs(other.upper.hi));
+                return widened(lower + other.lower, upper + other.upper, magnitude);
+            }
+
+            double_double_interval operator-(const double_double_interval& other) const {
+                double magnitude = std::max(std::abs(lower.hi) + std::abs(other.upper.hi),
+                                            std::abs(upper.hi) + std::abs(other.lower.hi));
+                return widened(lower - other.upper, upper - other.lower, magnitude);
+            }
+
+            double_double_interval operator*(const double_double_interval& other) const {
+                double_double products[] = {lower * other.lower, lower * other.upper,
+                                            upper * other.lower, upper * other.upper};
+                return widened_extremes(products);
+            }
+
+            double_double_interval operator/(const double_double_interval& other) const {
+                if (other.contains_zero())
+                    return double_double_interval();
+
+                double_double quotients[] = {lower / other.lower, lower / other.upper,
+                                             upper / other.lower, upper / other.upper};
+                return widened_extremes(quotients);
+            }
+
+        private:
+            static constexpr int ERROR_EXPONENT = -98;
+            static constexpr int MINIMUM_ERROR_EXPONENT = -998;
+            static constexpr int MAXIMUM_EXPONENT = 900;
+
+            // the interval [lower - error, upper + error], with error = 2^ERROR_EXPONENT * magnitude
+            static double_double_interval widened(const double_double& lower, const double_double& upper,
+                                                  double magnitude) {
+                if (!(magnitude < std::ldexp(1.0, MAXIMUM_EXPONENT)))
+                    return double_double_interval();
+
+                double error = std::max(std::ldexp(magnitude, ERROR_EXPONENT),
+                                        std::ldexp(1.0, MINIMUM_ERROR_EXPONENT));
+                double infinity = std::numeric_limits<double>::infinity();
+
+                // the sums of the low parts are rounded, they are moved one more ulp outwards
+                return double_double_interval(double_double(lower.hi, std::nextafter(lower.lo - error, -infinity)),
+                                              double_double(upper.hi, std::nextafter(upper.lo + error, infinity)));
+            }
+
+            // the widened interval between the lowest and the highest of the results
+            static double_double_interval widened_extremes(const double_double (&results)[4]) {
+                double magnitude = 0;
+                for (const double_double& result : results) {
+                    if (std::isnan(result.hi))
+                        return double_double_interval();
+                    magnitude = std::max(magnitude, std::abs(result.hi));
+                }
+
+                return widened(*std::min_element(std::begin(results), std::end(results)),
+                               *std::max_element(std::begin(results), std::end(results)),
+                               // |result| <= |result.hi| (1 + 2^-52) and the error is relative
+                               2 * magnitude);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_DOUBLE_DOUBLE_INTERVAL_HPP
@@ -0,0 +1,165 @@
+#ifndef BOOST_REAL_DOUBLE_INTERVAL_HPP
+#define BOOST_REAL_DOUBLE_INTERVAL_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief An interval of doubles that encloses a number. It is used as a filter for the
+         * comparisons: the order of two numbers whose double intervals do not overlap is known
+         * without refining their exact intervals.
+         *
+         * @details Every operation is done in round to nearest and the result is widened by one ulp at
+         * each side (outward rounding), so the true result is always enclosed. Overflows give an
+         * unbounded side and undefined operations give the whole real line, they never decide anything.
+         */
+        struct double_interval {
+            double lower = -std::numeric_limits<double>::infinity();
+            double upper = std::numeric_limits<double>::infinity();
+
+            /// @brief *default constructor*: It constructs the whole real line, which decides nothing.
+            double_interval() = default;
+
+            double_interval(double lower, double upper) : lower(lower), upper(upper) {
+                if (std::isnan(lower) || std::isnan(upper))
+                    *this = double_interval();
+            }
+
+            /// the interval that contains digit, which may not be representable as a double
+            template <typename T>
+            static double_interval from_digit(T digit) {
+                double value = (double) digit;
+                double_interval result(value, value);
+
+                if (std::abs(value) < std::ldexp(1.0, std::numeric_limits<T>::digits)) {
+                    if ((T) value > digit)
+                        result.lower = std::nextafter(value, -std::numeric_limits<double>::infinity());
+                    else if ((T) value < digit)
+                        result.upper = std::nextafter(value, std::numeric_limits<double>::infinity());
+                } else {
+                    result = widened(value, value);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief The interval that contains the number 0.d1d2d3... * base^exponent, given its leading
+             * digits. If the digits are truncated (more_digits), the rest of them add up to less than a
+             * unit of the last leading digit.
+             */
+            template <typename T>
+            static double_interval from_digits(const std::vector<T>& leading_digits, int exponent,
+                                               bool positive, bool more_digits, T base) {
+                double_interval digits_base = from_digit(base);
+                double_interval result(0, 0);
+
+                for (T digit : leading_digits)
+                    result = result * digits_base + from_digit(digit);
+
+                if (more_digits)
+                    result = result + double_interval(0, 1);
+
+                result = result * power(digits_base, exponent - (int) leading_digits.size());
+
+                if (!positive)
+                    result = double_interval(-result.upper, -result.lower);
+
+                return result;
+            }
+
+            /// x^n with outward rounding
+            static double_interval power(double_interval x, int n) {
+                bool reciprocal = n < 0;
+                unsigned int remaining = reciprocal ? -(unsigned int) n : n;
+                double_interval result(1, 1);
+
+                while (remaining > 0) {
+                    if (remaining & 1)
+                        result = result * x;
+                    x = x * x;
+                    remaining >>= 1;
+                }
+
+                return reciprocal ? double_interval(1, 1) / result : result;
+            }
+
+            /// true if both sides are finite and equal, so the interval is a single number
+            bool is_a_number() const {
+                return lower == upper && std::isfinite(lower);
+            }
+
+            bool contains_zero() const {
+                return lower <= 0 && 0 <= upper;
+            }
+
+            /// true if every number in *this is lower than every number in other
+            bool operator<(const double_interval& other) const {
+                return upper < other.lower;
+            }
+
+            /// -x, exact
+            double_interval operator-() const {
+                return double_interval(-upper, -lower);
+            }
+
+            /// |x|, exact
+            double_interval abs() const {
+                if (0 <= lower)
+                    return *this;
+                if (upper <= 0)
+                    return -*this;
+                return double_interval(0, std::max(-lower, upper));
+            }
+
+            double_interval operator+(const double_interval& other) const {
+                return widened(lower + other.lower, upper + other.upper);
+            }
+
+            double_interval operator-(const double_interval& other) const {
+                return widened(lower - other.upper, upper - other.lower);
+            }
+
+            double_interval operator*(const double_interval& other) const {
+                double products[] = {lower * other.lower, lower * other.upper,
+                                     upper * other.lower, upper * other.upper};
+
+                for (double product : products)
+                    if (std::isnan(product)) // 0 * infinity
+                        return double_interval();
+
+                return widened(*std::min_element(std::begin(products), std::end(products)),
+                               *std::max_element(std::begin(products), std::end(products)));
+            }
+
+            double_interval operator/(const double_interval& other) const {
+                if (other.contains_zero())
+                    return double_interval();
+
+                double quotients[] = {lower / other.lower, lower / other.upper,
+                                      upper / other.lower, upper / other.upper};
+
+                for (double quotient : quotients)
+                    if (std::isnan(quotient)) // infinity / infinity
+                        return double_interval();
+
+                return widened(*std::min_element(std::begin(quotients), std::end(quotients)),
+                               *std::max_element(std::begin(quotients), std::end(quotients)));
+            }
+
+        private:
+            // the rounded to nearest results are at most half an ulp away from the exact ones
+            static double_interval widened(double lower, double upper) {
+                return double_interval(std::nextafter(lower, -std::numeric_limits<double>::infinity()),
+                                       std::nextafter(upper, std::numeric_limits<double>::infinity()));
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_DOUBLE_INTERVAL_HPP
@@ -10,6 +10,10 @@
 #include <limits>
 #include <iterator>
 #include <cctype>
+#include <cmath>
+#include <string_view>
+
+#include <real/real_exception.hpp>
 
 namespace boost {
     namespace real {
@@ -24,6 +28,116 @@ namespace boost {
             exponent_t exponent = 0;
             bool positive = true;
 
+            // Decimal strings are converted from and to the internal base through limbs of
+            // DECIMAL_LIMB_DIGITS decimal digits, 10^9 for 32 bits digits and 10^18 for 64 bits digits, so
+            // each step multiplies by a whole limb. A digit times a limb plus a carry fits in wide_t.
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef __int128 int128_t;
+            using wide_t = std::conditional_t<(std::numeric_limits<T>::digits <= 31), long long, int128_t>;
+#else
+            using wide_t = long long;
+#endif
+            static constexpr int DECIMAL_LIMB_DIGITS = (std::numeric_limits<T>::digits <= 31) ? 9 : 18;
+
+            static constexpr T decimal_limb_base() {
+                T result = 1;
+                for (int i = 0; i < DECIMAL_LIMB_DIGITS; i++)
+                    result *= 10;
+                return result;
+            }
+
+            /**
+             * @brief The digits in the internal base of the non negative integer written with the decimal
+             * digits, without leading zeros. Zero has no digits.
+             */
+            static std::vector<T> digits_from_decimal(std::string_view decimal) {
+                static_assert(sizeof(wide_t) > sizeof(T), "decimal conversions need a 128 bits integer for 64 bits digits");
+                const T base = (std::numeric_limits<T>::max() /4)*2;
+
+                // least significant digit first
+                std::vector<T> result;
+                size_t length = decimal.size() % DECIMAL_LIMB_DIGITS;
+                if (length == 0)
+                    length = DECIMAL_LIMB_DIGITS;
+
+                for (size_t start = 0; start < decimal.size(); start += length, length = DECIMAL_LIMB_DIGITS) {
+                    T limb = 0;
+                    T scale = 1;
+                    for (size_t i = start; i < start + length; i++) {
+                        limb = limb * 10 + (decimal[i] - '0');
+                        scale *= 10;
+                    }
+
+                    // result = result * scale + limb
+                    wide_t carry = limb;
+                    for (T& digit : result) {
+                        wide_t x = (wide_t) digit * scale + carry;
+                        digit = (T) (x % base);
+                        carry = x / base;
+                    }
+                    for (; carry > 0; carry /= base)
+                        result.push_back((T) (carry % base));
+                }
+
+                std::reverse(result.begin(), result.end());
+                return result;
+            }
+
+            /// the decimal digits of the non negative integer with the given digits in the internal base
+            static std::string decimal_from_digits(const std::vector<T>& integer) {
+                static_assert(sizeof(wide_t) > sizeof(T), "decimal conversions need a 128 bits integer for 64 bits digits");
+                const T base = (std::numeric_limits<T>::max() /4)*2;
+                const T limb_base = decimal_limb_base();
+
+                // limbs of decimal digits, least significant first
+                std::vector<T> limbs;
+                for (T digit : integer) {
+                    // limbs = limbs * base + digit
+                    wide_t carry = digit;
+                    for (T& limb : limbs) {
+                        wide_t x = (wide_t) limb * base + carry;
+                        limb = (T) (x % limb_base);
+                        carry = x / limb_base;
+                    }
+                    for (; carry > 0; carry /= limb_base)
+                        limbs.push_back((T) (carry % limb_base));
+                }
+
+                if (limbs.empty())
+                    return "0";
+
+                std::string result = std::to_string(limbs.back());
+                for (size_t i = limbs.size() - 1; i-- > 0; ) {
+                    std::string limb = std::to_string(limbs[i]);
+                    result += std::string(DECIMAL_LIMB_DIGITS - limb.size(), '0') + limb;
+                }
+                return result;
+            }
+
+            /// the first precision decimals of the fraction with the given digits in the internal base, truncated
+            static std::string decimal_fraction(std::vector<T> fraction, size_t precision) {
+                static_assert(sizeof(wide_t) > sizeof(T), "decimal conversions need a 128 bits integer for 64 bits digits");
+                const T base = (std::numeric_limits<T>::max() /4)*2;
+                const T limb_base = decimal_limb_base();
+
+                std::string result;
+                while (result.size() < precision) {
+                    // fraction * limb_base, the integer part is the next limb of decimals
+                    wide_t carry = 0;
+                    for (size_t i = fraction.size(); i-- > 0; ) {
+                        wide_t x = (wide_t) fraction[i] * limb_base + carry;
+                        fraction[i] = (T) (x % base);
+                        carry = x / base;
+                    }
+
+                    std::string limb = std::to_string((T) carry);
+                    result += std::string(DECIMAL_LIMB_DIGITS - limb.size(), '0') + limb;
+                }
+
+                result.resize(precision);
+                return result;
+            }
+
             static bool aligned_vectors_is_lower(const std::vector<T> &lhs, const std::vector<T> &rhs, bool equal = false) {
 
                 // Check if lhs is lower than rhs
@@ -48,7 +162,7 @@ namespace boost {
             }
 
             /// adds other to *this. disregards sign -- that's taken care of in the operators.
-            void add_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
+            void add_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1){
                 int carry = 0;
                 std::vector<T> temp;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
@@ -104,7 +218,7 @@ namespace boost {
             }
 
             /// subtracts other from *this, disregards sign -- that's taken care of in the operators
-            void subtract_vector(exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
+            void subtract_vector(const exact_number &other, T base = (std::numeric_limits<T>::max() /4)*2 - 1) {
                 std::vector<T> result;
                 int fractional_length = std::max((int)this->digits.size() - this->exponent, (int)other.digits.size() - other.exponent);
                 int integral_length = std::max(this->exponent, other.exponent);
@@ -751,6 +865,14 @@ namespace boost {
                     exponent *= -1;
                 }
 
+                // the zeros between the integer and the decimal digits are digits of the number too
+                if (integer_count > 0 && decimal_count > 0) {
+                    integer_count += integer_rhs_zeros;
+                    decimal_count += decimal_lhs_zeros;
+                    integer_rhs_zeros = 0;
+                    decimal_lhs_zeros = 0;
+                }
+
                 exponent += integer_count;
 
                 if (integer_count == 0) {
@@ -895,13 +1017,13 @@ namespace boost {
                 return !(*this == other);
             }
 
-            exact_number<T> abs() {
+            exact_number<T> abs() const {
                 exact_number<T> result = (*this);
                 result.positive = true;
                 return result;
             }
 
-            exact_number<T> operator+(exact_number<T> other) {
+            exact_number<T> operator+(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive == other.positive) {
@@ -943,7 +1065,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator-(exact_number<T> other) {
+            exact_number<T> operator-(exact_number<T> other) const {
                 exact_number<T> result;
 
                 if (this->positive != other.positive) {
@@ -992,7 +1114,7 @@ namespace boost {
                 return result;
             }
 
-            exact_number<T> operator*(exact_number<T> other) {
+            exact_number<T> operator*(exact_number<T> other) const {
                 exact_number<T> result = *this;
                 result.multiply_vector(other);
                 result.positive = (this->positive == other.positive);
@@ -1017,181 +1139,31 @@ namespace boost {
              * @return a string that represents the state of the boost::real::exact_number
              */
             std::string as_string() const {
-                std::string result = "";   
-                exact_number<T> tmp;         
-
-                // If the number is too large, scientific notation is used to print it.
-                /* @TODO add back later
-                if ((this->exponent < -10) || (this->exponent > (int)this->digits.size() + 10)) {
-                    result += "0|.";
-                    for (const auto& d: this->digits) {
-                        result += std::to_string(d);
-                        result += "|";
-                    }
-                    result += "e" + std::to_string(this->exponent);
+                // the digits of the integer part, and of the fractional part from the first one after the point
+                std::vector<T> integer_part;
+                std::vector<T> fraction;
+                for (int i = 0; i < this->exponent; ++i)
+                    integer_part.push_back(i < (int) this->digits.size() ? this->digits[i] : 0);
+                for (int i = std::min(this->exponent, 0); i < (int) this->digits.size(); ++i)
+                    if (i >= this->exponent)
+                        fraction.push_back(i < 0 ? 0 : this->digits[i]);
+
+                std::string result = (positive ? "" : "-") + decimal_from_digits(integer_part);
+                if (fraction.empty())
                     return result;
-                }
-                */
-
-                if (this->exponent <= 0) {
-                    result += ".";
-
-                    for (int i = this->exponent; i < (int) this->digits.size(); ++i) {
-                        if (i < 0) {
-                            result += "0";
-                            result += " ";
-                        } else {
-                            result += std::to_string(this->digits[i]);
-                            result += " ";
-                        }
-                    }
-                } else {
-                    int digit_amount = std::max(this->exponent, (int) this->digits.size());
-
-                    for (int i = 0; i < digit_amount; ++i) {
 
-                        if (i == this->exponent) {
-                            result += ".";
-                        }
+                // as many decimals as the digits of base^(fraction digits + 1), plus one
+                T base = (std::numeric_limits<T>::max() /4)*2;
+                size_t precision = (size_t) ((fraction.size() + 1) * std::log10((long double) base)) + 2;
+                std::string decimals = decimal_fraction(fraction, precision);
 
-                        if (i < (int) this->digits.size()) {
-                            result += std::to_string(this->digits[i]);
-                            result += " ";
-                        } else {
-                            result += "0";
-                            result += " ";
-                        }
-                    }
+                while (!decimals.empty() && decimals.back() == '0')
+                    decimals.pop_back();
 
-                    if (result.back() == '.') {
-                        result.pop_back();
-                    }
-                }
-
-                //Use "return result" here for actual internal representation output for debugging
-
-                //Form new string below in base 10.
-                std::vector<T> new_result = {0};
-                std::size_t dot_pos = result.find('.');
-                std::string integer_part;
-                std::string decimal_part;
-                if (dot_pos == std::string::npos) {
-                    integer_part = result;
-                    decimal_part = "";
-                } else {
-                    integer_part = result.substr(0, dot_pos);
-                    decimal_part = result.substr(dot_pos + 1);
-                }
-                std::stringstream ss1(integer_part);
-                std::istream_iterator<std::string> begin1(ss1);
-                std::istream_iterator<std::string> end1;
-                std::vector<std::string> integer(begin1, end1);
-                std::stringstream ss2(decimal_part);
-                std::istream_iterator<std::string> begin2(ss2);
-                std::istream_iterator<std::string> end2;
-                std::vector<std::string> decimal(begin2, end2);
-                std::reverse (decimal.begin(), decimal.end()); 
-
-                //integer and decimal are string vectors with the "digits" in diff base
-                T b = (std::numeric_limits<T>::max() /4)*2;
-                std::vector<T> base;
-                while (b!=0) {
-                    base.push_back(b%10);
-                    b /=10;
-                }
-                std::reverse(base.begin(), base.end());
-                while(!integer.empty()) {
-                    std::vector<T> temp;
-                    std::string num = integer.back();
-                    integer.pop_back();
-                    for (auto j : num) {
-                        temp.push_back(j - '0');
-                    }
-                    tmp = (exact_number<T>(new_result).base10_add(exact_number<T>(temp)));
-                    new_result = tmp.digits;
-                    while (tmp.exponent - (int)tmp.digits.size() > 0) {
-                        new_result.push_back(0);
-                        tmp.exponent--;
-                    }
-                    for (size_t i = 0; i < integer.size(); ++i) {
-                        std::vector<T> temp;
-                        std::string tempstr = integer[i];
-                        for (size_t j = 0; j < tempstr.length(); ++j) {
-                            temp.push_back(tempstr[j] - '0'); 
-                        }
-                        tmp = (exact_number<T>(temp).base10_mult(exact_number<T>(base)));
-                        temp = tmp.digits;
-                        while (tmp.exponent - (int)tmp.digits.size() > 0) {
-                            temp.push_back(0);
-                            tmp.exponent--;
-                        }
-                        size_t idx = 0;
-                        while(idx < temp.size() && temp[idx]==0) 
-                            ++idx;
-                        temp.erase(temp.begin(), temp.begin() + idx);
-                        std::stringstream ss;
-                        std::copy( temp.begin(), temp.end(), std::ostream_iterator<T>(ss, ""));
-                        std::string str = ss.str();
-                        integer[i] = str;
-                    }
-                }
+                if (decimals.empty())
+                    return result;
 
-                std::stringstream ss;
-                std::copy( new_result.begin(), new_result.end(), std::ostream_iterator<T>(ss, ""));
-                std::string res_decimal = ss.str();
-                std::vector<T> new_base = base;
-                std::vector<std::vector<T>> powers = {base};
-                for (size_t i = 0; i<decimal.size(); ++i) {
-                    tmp = (exact_number<T>(new_base).base10_mult(exact_number<T>(base)));
-                    new_base = tmp.digits;
-                    while (tmp.exponent - (int)tmp.digits.size() > 0) {
-                        new_base.push_back(0);
-                        tmp.exponent--;
-                    }
-                    size_t idx = 0;
-                    while(idx < new_base.size() && new_base[idx]==0) 
-                        ++idx;
-                    new_base.erase(new_base.begin(), new_base.begin() + idx);
-                    powers.push_back(new_base);
-                }
-                size_t precision = powers.back().size() + 1;
-                std::string zeroes = "";
-                for (size_t i = 0; i<precision; ++i)
-                    zeroes = zeroes + "0";
-                std::vector<T> fraction = {0};
-                auto pwr = powers.cbegin();
-                while(!decimal.empty()) {
-                    std::string tempstr = decimal.back();
-                    decimal.pop_back();
-                    tempstr = tempstr + zeroes;
-                    std::vector<T> temp;
-                    for (size_t j = 0; j<tempstr.length(); ++j) {
-                        temp.push_back(tempstr[j] - '0'); 
-                    }
-                    std::vector<T> k = *pwr++;
-                    std::vector<T> q;
-                    tmp.long_divide_vectors(temp, k, q);
-                    tmp = (exact_number<T>(fraction).base10_add(exact_number<T>(q)));
-                    fraction = tmp.digits;
-                    while (tmp.exponent - (int)tmp.digits.size() > 0) {
-                        fraction.push_back(0);
-                        tmp.exponent--;
-                    }
-                }
-                std::stringstream sslast;
-                while (!fraction.empty() && fraction.back() == 0) {
-                    fraction.pop_back();
-                    --precision;
-                }
-                std::copy( fraction.begin(), fraction.end(), std::ostream_iterator<T>(sslast, ""));
-                std::string fractionstr = sslast.str();
-                while (fractionstr.length() < precision)
-                    fractionstr = "0" + fractionstr;
-                
-                if (fraction.empty())
-                    return (positive ? "" : "-") + res_decimal;
-                else
-                    return (positive ? "" : "-") + res_decimal + "." + fractionstr;
+                return result + "." + decimals;
             }
 
             /**
@@ -1285,13 +1257,12 @@ namespace boost {
             }
 
             /// returns an exact_number that has the precision given
-            exact_number<T> up_to(size_t precision, bool upper) {
+            exact_number<T> up_to(size_t precision, bool upper) const {
                 T base = (std::numeric_limits<T>::max() /4)*2 - 1;
                 if (precision >= digits.size())
                     return *this;
 
-                exact_number<T> ret = *this;
-                ret.digits = std::vector<T>(digits.begin(), digits.begin() + precision);
+                exact_number<T> ret(std::vector<T>(digits.begin(), digits.begin() + precision), exponent, positive);
 
                 bool round = (precision < digits.size());
                 if (round) {
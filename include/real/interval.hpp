@@ -45,6 +45,21 @@ namespace boost {
                 return result;
             }
 
+            /**
+             * @brief Calculates the width of the interval, i.e. the distance between both boundaries.
+             * The boundaries are normalized first, so a boundary that represents zero with a negative
+             * sign does not alter the result.
+             *
+             * @return a boost::real::exact_number with the upper boundary minus the lower boundary.
+             */
+            boost::real::exact_number<T> width() const {
+                boost::real::exact_number<T> lower = this->lower_bound;
+                boost::real::exact_number<T> upper = this->upper_bound;
+                lower.normalize();
+                upper.normalize();
+                return upper - lower;
+            }
+
             /**
              * @brief Swaps the lower boundary with the upper boundary. After this method is called
              * the boost::real::interval boundaries are swapped.
@@ -0,0 +1,213 @@
+#ifndef BOOST_REAL_NODE_TABLE_HPP
+#define BOOST_REAL_NODE_TABLE_HPP
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <real/real_data.hpp>
+#include <real/real_explicit.hpp>
+#include <real/real_operation.hpp>
+#include <real/real_rational.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Opt-in hash-consing of the nodes of the boost::real::real numbers. When it is enabled,
+         * explicit numbers with the same digits, exponent and sign, rational numbers with the same
+         * numerator and denominator, and operations with the same
+         * operation, operand nodes and exponent, are built once: every number built the same way shares the
+         * node, so it is refined once. As the operands are shared too, structurally identical trees
+         * collapse into a single one.
+         *
+         * @details The nodes are interned in a table of weak pointers keyed by their structure, so the
+         * table never keeps a node alive, and the entries of the released nodes are dropped as the table
+         * grows. Algorithmic numbers, placeholders and the n-ary sums, products and dot products, which
+         * can be appended to in place, are never interned. Numbers that share a node share its maximum precision too.
+         */
+        template <typename T = int>
+        class node_table {
+            struct key {
+                OPERATION operation = OPERATION::ADDITION;
+                const real_data<T>* lhs = nullptr;
+                const real_data<T>* rhs = nullptr;
+                std::vector<T> digits;
+                // exponent of an explicit number, of a POWER or of a SCALE
+                long exponent = 0;
+                bool positive = true;
+                // denominator of a rational number, empty for explicit numbers
+                std::vector<T> denominator;
+                int denominator_exponent = 0;
+                // explicit and rational numbers have no operands
+                bool leaf = true;
+
+                bool operator==(const key& other) const {
+                    return leaf == other.leaf && operation == other.operation && lhs == other.lhs &&
+                           rhs == other.rhs && exponent == other.exponent && positive == other.positive &&
+                           digits == other.digits && denominator_exponent == other.denominator_exponent &&
+                           denominator == other.denominator;
+                }
+            };
+
+            struct key_hash {
+                size_t operator()(const key& k) const {
+                    size_t result = std::hash<bool>()(k.leaf);
+                    auto combine = [&result] (size_t value) {
+                        result ^= value + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+                    };
+
+                    combine(std::hash<int>()((int) k.operation));
+                    combine(std::hash<const real_data<T>*>()(k.lhs));
+                    combine(std::hash<const real_data<T>*>()(k.rhs));
+                    combine(std::hash<long>()(k.exponent));
+                    combine(std::hash<bool>()(k.positive));
+                    for (T digit : k.digits)
+                        combine(std::hash<T>()(digit));
+                    combine(std::hash<int>()(k.denominator_exponent));
+                    for (T digit : k.denominator)
+                        combine(std::hash<T>()(digit));
+
+                    return result;
+                }
+            };
+
+            inline static std::mutex _mutex;
+            inline static std::unordered_map<key, std::weak_ptr<real_data<T>>, key_hash> _nodes;
+
+            // the released nodes are dropped when the table reaches this size, which is then doubled
+            inline static size_t _sweep_size = 64;
+
+            static key key_of(const real_explicit<T>& x) {
+                key result;
+                result.digits = x.digits();
+                result.exponent = x.exponent();
+                result.positive = x.positive();
+                return result;
+            }
+
+            static key key_of(const real_rational<T>& x) {
+                key result;
+                result.digits = x.numerator().digits;
+                result.exponent = x.numerator().exponent;
+                result.positive = x.numerator().positive;
+                result.denominator = x.denominator().digits;
+                result.denominator_exponent = x.denominator().exponent;
+                return result;
+            }
+
+            static key key_of(const real_operation<T>& x) {
+                key result;
+                result.leaf = false;
+                result.operation = x.get_operation();
+                result.lhs = x.lhs().get();
+                result.rhs = x.rhs().get();
+                result.exponent = x.exponent();
+                return result;
+            }
+
+            // only explicit numbers, rational numbers and operations are interned
+            static key key_of(const real_number<T>& x) {
+                if (auto explicit_ptr = std::get_if<real_explicit<T>>(&x))
+                    return key_of(*explicit_ptr);
+                if (auto rational_ptr = std::get_if<real_rational<T>>(&x))
+                    return key_of(*rational_ptr);
+                return key_of(std::get<real_operation<T>>(x));
+            }
+
+            static void sweep() {
+                for (auto it = _nodes.begin(); it != _nodes.end(); ) {
+                    if (it->second.expired())
+                        it = _nodes.erase(it);
+                    else
+                        ++it;
+                }
+                _sweep_size = std::max<size_t>(64, 2 * _nodes.size());
+            }
+
+            template <typename Number>
+            static std::shared_ptr<real_data<T>> intern(Number x) {
+                key k = key_of(x);
+
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto it = _nodes.find(k);
+                    if (it != _nodes.end())
+                        if (std::shared_ptr<real_data<T>> node = it->second.lock())
+                            return node;
+                }
+
+                // operations calculate their first interval when they are built, so it is done unlocked
+                std::shared_ptr<real_data<T>> node = std::make_shared<real_data<T>>(std::move(x));
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                std::weak_ptr<real_data<T>>& entry = _nodes[k];
+                if (std::shared_ptr<real_data<T>> other = entry.lock()) // built by another thread meanwhile
+                    return other;
+
+                entry = node;
+                node->_interned = true;
+                if (_nodes.size() >= _sweep_size)
+                    sweep();
+
+                return node;
+            }
+
+        public:
+            /**
+             * @brief When set, the numbers built afterwards are interned. Numbers built before are not
+             * looked up.
+             */
+            inline static bool enabled = false;
+
+            /**
+             * @brief Builds the node of x, or returns the node already built the same way if hash-consing
+             * is enabled and x can be interned.
+             */
+            template <typename Number>
+            static std::shared_ptr<real_data<T>> make(Number x) {
+                if constexpr (std::is_same_v<Number, real_explicit<T>> || std::is_same_v<Number, real_rational<T>>) {
+                    if (enabled)
+                        return intern(std::move(x));
+                } else if constexpr (std::is_same_v<Number, real_operation<T>>) {
+                    if (enabled && !x.is_nary())
+                        return intern(std::move(x));
+                }
+
+                return std::make_shared<real_data<T>>(std::move(x));
+            }
+
+            /**
+             * @brief Removes the entry of an interned node, so the table does not hand it out any more.
+             * Used by ~real_data before it unlinks the operands of a node it holds the only reference to.
+             *
+             * @return false if another thread looked the node up meanwhile, it must then be left intact.
+             */
+            static bool remove(const std::shared_ptr<real_data<T>>& node) {
+                // the table only hands out nodes under the lock, so the count cannot grow while it is held
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (node.use_count() != 1)
+                    return false;
+
+                auto it = _nodes.find(key_of(node->get_real_number()));
+                if (it != _nodes.end() && !it->second.owner_before(node) && !node.owner_before(it->second))
+                    _nodes.erase(it);
+                return true;
+            }
+
+            /// number of interned nodes that are still alive
+            static size_t size() {
+                std::lock_guard<std::mutex> lock(_mutex);
+                sweep();
+                return _nodes.size();
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_NODE_TABLE_HPP
@@ -0,0 +1,175 @@
+#ifndef BOOST_REAL_PARALLEL_EVALUATOR_HPP
+#define BOOST_REAL_PARALLEL_EVALUATOR_HPP
+
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/work_stealing_pool.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Opt-in evaluator that refines the independent subtrees of an operation tree in parallel
+         * on a boost::real::work_stealing_pool.
+         *
+         * @details The operation nodes are grouped by height, so every node of a level only depends on
+         * nodes of lower levels, and each level is refined in chunks of grain_size nodes. Trees with
+         * fewer than grain_size nodes to refine are evaluated inline by the sequential evaluator. Every
+         * node is refined exactly as the sequential evaluator does it, so the intervals are the same.
+         */
+        template <typename T = int>
+        class parallel_evaluator {
+            using iterator = const_precision_iterator<T>;
+
+            work_stealing_pool& _pool;
+            size_t _grain_size;
+
+            // A division whose divisor is not positive, as a negative power of an operand that is not,
+            // iterates its own subtree while calculating its boundaries (see update_operation_boundaries),
+            // so it cannot run next to nodes sharing operands.
+            static bool iterates_its_operands(real_operation<T>& ro) {
+                if (ro.is_unary())
+                    return ro.get_operation() == OPERATION::POWER && ro.exponent() < 0 &&
+                           !ro.get_lhs_itr().snapshot().positive();
+
+                return ro.get_operation() == OPERATION::DIVISION && !ro.get_rhs_itr().snapshot().positive();
+            }
+
+            // the nodes may be shared with other threads, which could have refined them already
+            static void refine(iterator* node, precision_t target) {
+                std::unique_lock<std::shared_mutex> lock = node->lock();
+                if (node->_precision >= target)
+                    return;
+
+                if (auto operation = std::get_if<real_operation<T>>(node->_real_ptr)) {
+                    node->_precision = target;
+                    node->update_operation_boundaries(*operation);
+                } else {
+                    node->iterate_n_times(target - node->_precision);
+                }
+            }
+
+            // groups the nodes below root that are not at the target precision by height, leaves first
+            static std::vector<std::vector<iterator*>> levels_below(real_operation<T>& root, precision_t target) {
+                std::vector<std::vector<iterator*>> levels;
+                std::unordered_map<iterator*, size_t> height;
+                std::vector<std::pair<iterator*, bool>> pending;
+
+                auto push_operands = [&](real_operation<T>& ro) {
+                    for (size_t i = 0; i < ro.operand_count(); i++) {
+                        iterator* operand = &ro.get_operand_itr(i);
+                        if (operand->current_precision() < target && height.find(operand) == height.end())
+                            pending.push_back({operand, false});
+                    }
+                };
+                push_operands(root);
+
+                while (!pending.empty()) {
+                    auto [node, operands_done] = pending.back();
+                    auto operation = std::get_if<real_operation<T>>(node->_real_ptr);
+
+                    if (!operands_done) {
+                        if (height.find(node) != height.end()) { // shared operand, already collected
+                            pending.pop_back();
+                            continue;
+                        }
+
+                        height[node] = 0;
+                        if (operation) {
+                            pending.back().second = true;
+                            push_operands(*operation);
+                            continue;
+                        }
+                    } else {
+                        for (size_t i = 0; i < operation->operand_count(); i++) {
+                            auto operand_height = height.find(&operation->get_operand_itr(i));
+                            if (operand_height != height.end())
+                                height[node] = std::max(height[node], operand_height->second + 1);
+                        }
+                    }
+
+                    pending.pop_back();
+                    if (levels.size() <= height[node])
+                        levels.resize(height[node] + 1);
+                    levels[height[node]].push_back(node);
+                }
+
+                return levels;
+            }
+
+        public:
+            /**
+             * @param pool - the pool where the subtrees are refined.
+             * @param grain_size - minimum number of nodes refined by a task. Smaller trees and levels
+             * run in the calling thread.
+             */
+            explicit parallel_evaluator(work_stealing_pool& pool, size_t grain_size = 64)
+                    : _pool(pool), _grain_size(grain_size) {}
+
+            /**
+             * @brief Parallel version of const_precision_iterator::iterate_n_times. The operands of it
+             * are refined to the new precision level by level, then it is refined.
+             */
+            void iterate_n_times(iterator& it, int n) {
+                auto root = std::get_if<real_operation<T>>(it._real_ptr);
+                if (root == nullptr || n <= 0) {
+                    it.iterate_n_times(n);
+                    return;
+                }
+
+                precision_t target = it._precision + n;
+                std::vector<std::vector<iterator*>> levels = levels_below(*root, target);
+
+                size_t nodes = 0;
+                for (auto& level : levels)
+                    nodes += level.size();
+
+                if (nodes < _grain_size) {
+                    it.iterate_n_times(n);
+                    return;
+                }
+
+                for (std::vector<iterator*>& level : levels) {
+                    std::vector<iterator*> independent;
+                    std::vector<iterator*> serial;
+
+                    for (iterator* node : level) {
+                        auto operation = std::get_if<real_operation<T>>(node->_real_ptr);
+                        if (operation && iterates_its_operands(*operation))
+                            serial.push_back(node);
+                        else
+                            independent.push_back(node);
+                    }
+
+                    _pool.parallel_for(independent.size(), _grain_size, [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                            refine(independent[i], target);
+                    });
+
+                    for (iterator* node : serial)
+                        refine(node, target);
+                }
+
+                it._precision = target;
+                it.update_operation_boundaries(*root);
+            }
+
+            /**
+             * @brief Parallel version of x.get_real_itr().cend(): refines x up to its maximum precision.
+             *
+             * @return an iterator pointing to the interval of x at its maximum precision.
+             */
+            iterator cend(const real<T>& x) {
+                iterator it = x.get_real_itr();
+                iterate_n_times(it, (int)it.maximum_precision() - (int)it._precision);
+                return it;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_PARALLEL_EVALUATOR_HPP
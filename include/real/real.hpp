@@ -2,6 +2,7 @@
 #define BOOST_REAL_HPP
 
 #include <iostream>
+#include <limits>
 #include <optional>
 #include <vector>
 #include <regex>
@@ -9,14 +10,24 @@
 #include <sstream>
 #include <utility>
 #include <memory> // shared_ptr
+#include <mutex>
+#include <shared_mutex>
 #include <variant>
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+#include <compare>
+#endif
 
+#include <real/comparison.hpp>
 #include <real/real_exception.hpp>
 #include <real/real_explicit.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_operation.hpp>
+#include <real/real_placeholder.hpp>
+#include <real/real_rational.hpp>
 #include <real/const_precision_iterator.hpp>
 #include <real/real_data.hpp>
+#include <real/node_table.hpp>
+#include <real/real_tape.hpp>
 
 
 namespace boost {
@@ -53,6 +64,9 @@ namespace boost {
          *  creates pointers to the operands and each time the number is used, the operation is
          *  evaluated to return the result.
          *
+         * Decimal literals that are not integers are rational numbers, kept as an exact fraction (see
+         * boost::real::real_rational).
+         *
          * Two boost::real::real numbers can be compared by the lower operator "<" and by the equal
          * operator "==" but for those cases where the class is not able to decide the value of the
          * result before reaching the maximum precision, a precision_exception is thrown.
@@ -65,6 +79,104 @@ namespace boost {
             // ctor from shared_ptr to (already init) real_data. used in check_and_distribute.
             real(std::shared_ptr<real_data<T>> x) : _real_p(x){};
 
+            // reads the nodes of the expressions it evaluates, see real_batch.hpp
+            friend class real_batch<T>;
+
+            // refines *this and other together until their order is known or the maximum precision is
+            // reached. If width is not null, the width of the widest of both last intervals is stored in it.
+            ORDERING refine_and_compare(const real<T>& other, exact_number<T>* width) const {
+                // Filters: the double intervals calculated when the numbers were built decide most of the
+                // comparisons without refining anything. If they overlap, the double-double and then the
+                // fixed precision intervals are tried before the exact ones. They are skipped if the
+                // exact width is requested.
+                if (width == nullptr) {
+                    const double_interval& this_filter = this->_real_p->get_filter();
+                    const double_interval& other_filter = other._real_p->get_filter();
+
+                    if (this_filter < other_filter)
+                        return ORDERING::LESS;
+
+                    if (other_filter < this_filter)
+                        return ORDERING::GREATER;
+
+                    double_double_interval this_precise_filter = this->_real_p->get_double_double_filter();
+                    double_double_interval other_precise_filter = other._real_p->get_double_double_filter();
+
+                    if (this_precise_filter < other_precise_filter)
+                        return ORDERING::LESS;
+
+                    if (other_precise_filter < this_precise_filter)
+                        return ORDERING::GREATER;
+
+                    ORDERING fixed_order = this->_real_p->get_fixed_filter().compare(other._real_p->get_fixed_filter());
+                    if (fixed_order != ORDERING::UNDECIDED)
+                        return fixed_order;
+
+                    // rational numbers are compared exactly, even if their digits never end
+                    std::optional<real_rational<T>> this_rational = rational_of(*this->_real_p);
+                    std::optional<real_rational<T>> other_rational = rational_of(*other._real_p);
+                    if (this_rational && other_rational)
+                        return this_rational->compare(*other_rational);
+                }
+
+                auto this_it = this->_real_p->get_precision_itr().cbegin();
+                auto other_it = other._real_p->get_precision_itr().cbegin();
+
+                interval<T> this_interval = this_it.get_interval();
+                interval<T> other_interval = other_it.get_interval();
+                ORDERING result = ORDERING::UNDECIDED;
+
+                if (this_it == other_it) {
+                    result = ORDERING::EQUAL;
+                } else {
+                    unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
+                    for (unsigned int p = 0; p < current_precision; ++p) {
+                        // Get more precision
+                        ++this_it;
+                        ++other_it;
+
+                        this_interval = this_it.get_interval();
+                        other_interval = other_it.get_interval();
+
+                        if (this_interval < other_interval) {
+                            result = ORDERING::LESS;
+                            break;
+                        }
+
+                        if (other_interval < this_interval) {
+                            result = ORDERING::GREATER;
+                            break;
+                        }
+
+                        // two numbers that do not overlap and are fully represented must be equals
+                        if (this_interval.is_a_number() && other_interval.is_a_number()) {
+                            result = ORDERING::EQUAL;
+                            break;
+                        }
+                    }
+                    // If the precision is reached and the number ranges still overlap, then we cannot
+                    // know if they are equals or one is less than the other: result stays UNDECIDED.
+                }
+
+                if (width != nullptr) {
+                    exact_number<T> this_width = this_interval.width();
+                    exact_number<T> other_width = other_interval.width();
+                    *width = (this_width < other_width) ? other_width : this_width;
+                }
+
+                return result;
+            }
+
+            // compare(), but throws if the order between both numbers could not be determined.
+            ORDERING decided_compare(const real<T>& other) const {
+                ORDERING result = compare(other);
+
+                if (result == ORDERING::UNDECIDED)
+                    throw boost::real::precision_exception();
+
+                return result;
+            }
+
         public:
             /// @TODO: Move constructors to move directly from the ctors in real_explicit to the values in real_data
             /// @TODO: do we need different ctors to be more efficient? rvalue AND lvalue ref?
@@ -86,7 +198,8 @@ namespace boost {
 
 
             /**
-             * @brief String constructor. Returns an exact number if possible to be represented in internal base. Else division number is returned.
+             * @brief String constructor. Returns an exact number if possible to be represented in internal base. Else a rational
+             * number, the fraction of the digits over a power of ten, is returned.
              *
              * @param number - a valid string representing a number.
              *
@@ -96,7 +209,7 @@ namespace boost {
                 auto [integer_part, decimal_part, exponent, positive] = exact_number<>::number_from_string(number);
 
                 if ((int)(decimal_part.length() + integer_part.length()) <= exponent) {
-                    this->_real_p = std::make_shared<real_data<T>>(real_explicit<T>(integer_part, decimal_part, exponent, positive));
+                    this->_real_p = node_table<T>::make(real_explicit<T>(integer_part, decimal_part, exponent, positive));
                 } else {
                     int zeroes = decimal_part.length() + integer_part.length() - exponent;
                     std::string denominator = "1";
@@ -107,10 +220,9 @@ namespace boost {
                     std::string numerator = (std::string) std::string(integer_part).c_str() + (std::string) std::string(decimal_part);
                     if (!positive)
                         numerator = "-" + numerator;
-                    std::shared_ptr<real_data<T>> lhs = std::make_shared<real_data<T>>(real_explicit<T>(numerator));
-                    std::shared_ptr<real_data<T>> rhs = std::make_shared<real_data<T>>(real_explicit<T>(denominator));
-    
-                    this->_real_p  = std::make_shared<real_data<T>>(real_operation(lhs, rhs, OPERATION::DIVISION));
+
+                    this->_real_p = node_table<T>::make(real_rational<T>(real_explicit<T>(numerator).get_exact_number(),
+                                                                         real_explicit<T>(denominator).get_exact_number()));
                 }
             }
 
@@ -120,7 +232,7 @@ namespace boost {
              * @param digits - a initializer_list<T> that represents the number digits.
              */
             real(std::initializer_list<T> digits)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size())))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, digits.size())))
                 {};
 
             /**
@@ -134,7 +246,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(std::initializer_list<T> digits, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, digits.size(), positive)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, digits.size(), positive)))
                     {};
 
             /**
@@ -147,7 +259,7 @@ namespace boost {
              * @param exponent - an integer representing the number exponent.
              */
             real(std::initializer_list<T> digits, int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, exponent)))
                     {};
 
             /**
@@ -162,7 +274,7 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(::std::initializer_list<T> digits, int exponent, bool positive)
-                    : _real_p(std::make_shared<real_data<T>>(real_explicit<T>(digits, exponent, positive)))
+                    : _real_p(node_table<T>::make(real_explicit<T>(digits, exponent, positive)))
                     {};
 
             /**
@@ -176,7 +288,7 @@ namespace boost {
              * @param exponent - an integer representing the number exponent.
              */
             real(T (*get_nth_digit)(unsigned int), int exponent)
-                    : _real_p(std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent)))
+                    : _real_p(node_table<T>::make(real_algorithm<T>(get_nth_digit, exponent)))
                     {};
 
             /**
@@ -193,12 +305,24 @@ namespace boost {
              * the number is positive, otherwise is negative.
              */
             real(T (*get_nth_digit)(unsigned int), int exponent, bool positive) 
-                 : _real_p(::std::make_shared<real_data<T>>(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
+                 : _real_p(node_table<T>::make(real_algorithm<T>(get_nth_digit, exponent, positive))) {};
 
             // ctors from the 3 underlying types
-            real(real_explicit<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_algorithm<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
-            real(real_operation<T> x) : _real_p(std::make_shared<real_data<T>>(x)) {};
+            real(real_explicit<T> x) : _real_p(node_table<T>::make(x)) {};
+            real(real_algorithm<T> x) : _real_p(node_table<T>::make(x)) {};
+            real(real_operation<T> x) : _real_p(node_table<T>::make(x)) {};
+            real(real_rational<T> x) : _real_p(node_table<T>::make(x)) {};
+
+            /**
+             * @brief Creates a placeholder: a leaf that stands for value until it is bound to another
+             * number with bind(). An operation tree built on placeholders can be evaluated for new
+             * inputs without building it again.
+             *
+             * @param value - the number the placeholder stands for at first.
+             */
+            static real<T> placeholder(const real<T>& value) {
+                return real<T>(node_table<T>::make(real_placeholder<T>(value._real_p)));
+            }
 
             /**
              * @brief Default destructor
@@ -209,7 +333,9 @@ namespace boost {
                 return _real_p->get_real_number();
             }
 
+            /// copy of the shared iterator of the number, it can be refined without locking
             const_precision_iterator<T> get_real_itr() const {
+                std::shared_lock<std::shared_mutex> lock(_real_p->get_mutex());
                 return _real_p->get_precision_itr();
             }
 
@@ -225,9 +351,71 @@ namespace boost {
 
             /// set max precision for the underlying iterator
             void set_maximum_precision(unsigned int maximum_precision) {
+                std::unique_lock<std::shared_mutex> lock(_real_p->get_mutex());
                 this->_real_p->get_precision_itr().set_maximum_precision(maximum_precision);
             }
 
+            /**
+             * @brief Demand-driven evaluation: refines the number until its approximation interval
+             * is at most base^error_exponent wide, where base is the internal digits base. Each operation
+             * in the tree gives its operands only the error budget they need, computed from the
+             * magnitude of their intervals.
+             *
+             * @param error_exponent - the requested absolute error is base^error_exponent.
+             * @return the approximation interval reached.
+             *
+             * @throws boost::real::precision_exception if the error cannot be reached without
+             * exceeding the maximum precision.
+             */
+            interval<T> approximate(int error_exponent) const {
+                std::unique_lock<std::shared_mutex> lock(_real_p->get_mutex());
+                const_precision_iterator<T>& it = this->_real_p->get_precision_itr();
+                it.refine_to(error_exponent);
+                return it.get_interval();
+            }
+
+            /**
+             * @brief Converts the number to a fixed precision interval with Limbs digits. The leaves are
+             * read up to Limbs digits and the operations are done in fixed precision, nothing is refined.
+             * For a tighter enclosure, the interval returned by approximate() can be converted instead.
+             *
+             * @return a boost::real::real_fixed that encloses the number. It is not bounded if a divisor
+             * could not be told apart from zero.
+             */
+            template <size_t Limbs>
+            real_fixed<T, Limbs> fixed() const {
+                return this->_real_p->template enclosure<Limbs>();
+            }
+
+            /**
+             * @brief Compiles the operation tree of the number into a boost::real::real_tape, which refines
+             * all its nodes with a single pass over contiguous instructions per precision step.
+             *
+             * @return a boost::real::real_tape evaluated at the lowest precision.
+             */
+            real_tape<T> compile() const {
+                return real_tape<T>(this->_real_p);
+            }
+
+            /**
+             * @brief Binds a placeholder, created with real::placeholder(), to value. The nodes of *this
+             * that depend on the placeholder drop their cached intervals and are evaluated again from the
+             * lowest precision, the other nodes keep theirs.
+             *
+             * @details Other numbers that contain the placeholder must be bound through too before they are
+             * evaluated again, and tapes compiled before must be compiled again. Numbers that contain the
+             * placeholder must not be evaluated by other threads meanwhile.
+             *
+             * @param placeholder - a placeholder, usually a leaf of *this.
+             * @param value - the number the placeholder stands for from now on.
+             *
+             * @throws boost::real::bad_variant_access_exception if placeholder is not a placeholder.
+             * @throws boost::real::invalid_representation_exception if value contains the placeholder.
+             */
+            void bind(const real<T>& placeholder, const real<T>& value) {
+                this->_real_p->bind(*placeholder._real_p, value._real_p);
+            }
+
             /************** Operators ******************/
             
             /**
@@ -249,6 +437,12 @@ namespace boost {
                     [&n, &ret] (const real_algorithm<T>& real) {
                         ret = real[n];
                     },
+                    [&n, &ret] (const real_rational<T>& real) {
+                        ret = real[n];
+                    },
+                    [&n, &ret] (const real_placeholder<T>& real) {
+                        ret = ((boost::real::real<T>) real.value())[n];
+                    },
                     [] (const real_operation<T>& real) {
                         throw boost::real::bad_variant_access_exception();
                     },
@@ -277,30 +471,84 @@ namespace boost {
                             std::cout << ' ';
                         std::cout << "alg\n";
                     },
-                    [&space] (const real_operation<T>& real) {
-                        ((boost::real::real<T>) real.rhs()).print_tree(space + PRINT_SPACE);
-                        std::cout << '\n';
-
+                    [space] (const real_rational<T>& real) {
                         for (int i = PRINT_SPACE; i < space; i++)
                             std::cout << ' ';
+                        std::cout << real.numerator().as_string() << '/' << real.denominator().as_string() << '\n';
+                    },
+                    [&space] (const real_operation<T>& real) {
+                        // the exponent of a power, and the power of the base of a scaling, are printed as their
+                        // second operand. A negation or an absolute value is printed above its operand.
+                        if (real.is_unary()) {
+                            if (real.get_operation() == OPERATION::POWER || real.get_operation() == OPERATION::SCALE) {
+                                for (int i = PRINT_SPACE; i < space + PRINT_SPACE; i++)
+                                    std::cout << ' ';
+                                if (real.get_operation() == OPERATION::SCALE)
+                                    std::cout << "base^";
+                                std::cout << real.exponent() << "\n\n";
+                            }
 
-                        switch(real.get_operation()) {
-                            case OPERATION::ADDITION:
-                                std::cout << "+";
-                                break;
-                            case OPERATION::SUBTRACTION:
-                                std::cout << "-";
-                                break;
-                            case OPERATION::MULTIPLICATION:
-                                std::cout << "*";
-                                break;
-                            case OPERATION::DIVISION:
-                                std::cout << "/";
-                                break;
+                            for (int i = PRINT_SPACE; i < space; i++)
+                                std::cout << ' ';
+
+                            switch (real.get_operation()) {
+                                case OPERATION::POWER:
+                                    std::cout << "^\n";
+                                    break;
+                                case OPERATION::SCALE:
+                                    std::cout << "*\n";
+                                    break;
+                                case OPERATION::NEGATE:
+                                    std::cout << "-\n";
+                                    break;
+                                default:
+                                    std::cout << "abs\n";
+                                    break;
+                            }
                         }
-                        std::cout << '\n';
 
-                        ((boost::real::real<T>) real.lhs()).print_tree(space + PRINT_SPACE);
+                        // the operands are printed last to first, with the operation between each of them
+                        for (size_t i = real.operand_count(); i-- > 0; ) {
+                            ((boost::real::real<T>) real.operand(i)).print_tree(space + PRINT_SPACE);
+                            if (i == 0)
+                                break;
+
+                            std::cout << '\n';
+
+                            for (int i = PRINT_SPACE; i < space; i++)
+                                std::cout << ' ';
+
+                            switch(real.get_operation()) {
+                                case OPERATION::ADDITION:
+                                case OPERATION::SUM:
+                                    std::cout << "+";
+                                    break;
+                                case OPERATION::SUBTRACTION:
+                                    std::cout << "-";
+                                    break;
+                                case OPERATION::MULTIPLICATION:
+                                case OPERATION::PRODUCT:
+                                    std::cout << "*";
+                                    break;
+                                case OPERATION::DIVISION:
+                                    std::cout << "/";
+                                    break;
+                                case OPERATION::POWER:
+                                case OPERATION::NEGATE:
+                                case OPERATION::ABS:
+                                case OPERATION::SCALE:
+                                    // unary, printed above their operand
+                                    break;
+                                case OPERATION::DOT:
+                                    // the operands i - 1 and i are multiplied if i is odd
+                                    std::cout << (i % 2 == 1 ? "*" : "+");
+                                    break;
+                            }
+                            std::cout << '\n';
+                        }
+                    },
+                    [&space] (const real_placeholder<T>& real) {
+                        ((boost::real::real<T>) real.value()).print_tree(space);
                     },
                     [] (auto& real) {
                         throw boost::real::bad_variant_access_exception();
@@ -308,6 +556,270 @@ namespace boost {
                 }, _real_p->get_real_number());
             }
 
+            // true if x is an explicit number equal to zero
+            static bool is_explicit_zero(const real_data<T>& x) {
+                auto explicit_ptr = std::get_if<real_explicit<T>>(&x.get_real_number());
+                if (explicit_ptr == nullptr)
+                    return false;
+
+                for (T digit : explicit_ptr->digits())
+                    if (digit != 0)
+                        return false;
+
+                return true;
+            }
+
+            // true if x is an explicit number equal to one
+            static bool is_explicit_one(const real_data<T>& x) {
+                auto explicit_ptr = std::get_if<real_explicit<T>>(&x.get_real_number());
+                if (explicit_ptr == nullptr)
+                    return false;
+
+                exact_number<T> number = explicit_ptr->get_exact_number();
+                number.normalize();
+                return number.positive && number.exponent == 1 && number.digits == std::vector<T>{1};
+            }
+
+            // Folds the operation lhs op rhs when it is built. Additions, subtractions and multiplications
+            // of two explicit numbers are calculated exactly once, into a new explicit number, and the
+            // identities x + 0, 0 + x, x - 0, x * 1, 1 * x, x * 0, 0 * x and x - x (for the same node) are
+            // resolved to an operand or to zero. The other operations between rational and explicit numbers
+            // are calculated exactly into a rational number, or an explicit one if it is an integer.
+            // Returns nullptr if the operation cannot be folded.
+            static std::shared_ptr<real_data<T>> fold(const std::shared_ptr<real_data<T>>& lhs,
+                                                      const std::shared_ptr<real_data<T>>& rhs, OPERATION op) {
+                if (op != OPERATION::ADDITION && op != OPERATION::SUBTRACTION && op != OPERATION::MULTIPLICATION)
+                    return nullptr;
+
+                auto lhs_explicit = std::get_if<real_explicit<T>>(&lhs->get_real_number());
+                auto rhs_explicit = std::get_if<real_explicit<T>>(&rhs->get_real_number());
+
+                if (lhs_explicit != nullptr && rhs_explicit != nullptr) {
+                    exact_number<T> result;
+                    switch (op) {
+                        case OPERATION::ADDITION:
+                            result = lhs_explicit->get_exact_number() + rhs_explicit->get_exact_number();
+                            break;
+                        case OPERATION::SUBTRACTION:
+                            result = lhs_explicit->get_exact_number() - rhs_explicit->get_exact_number();
+                            break;
+                        default:
+                            result = lhs_explicit->get_exact_number() * rhs_explicit->get_exact_number();
+                            break;
+                    }
+
+                    result.normalize();
+                    if (result.digits.empty())
+                        result = exact_number<T>(std::vector<T>{0}, 0);
+
+                    return node_table<T>::make(real_explicit<T>(std::move(result)));
+                }
+
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        if (is_explicit_zero(*rhs))
+                            return lhs;
+                        if (is_explicit_zero(*lhs))
+                            return rhs;
+                        break;
+                    case OPERATION::SUBTRACTION:
+                        if (is_explicit_zero(*rhs))
+                            return lhs;
+                        if (lhs == rhs)
+                            return node_table<T>::make(real_explicit<T>(exact_number<T>(std::vector<T>{0}, 0)));
+                        break;
+                    default:
+                        if (is_explicit_zero(*lhs))
+                            return lhs;
+                        if (is_explicit_zero(*rhs))
+                            return rhs;
+                        if (is_explicit_one(*rhs))
+                            return lhs;
+                        if (is_explicit_one(*lhs))
+                            return rhs;
+                        break;
+                }
+
+                std::optional<real_rational<T>> lhs_rational = rational_of(*lhs);
+                std::optional<real_rational<T>> rhs_rational = rational_of(*rhs);
+                if (!lhs_rational || !rhs_rational)
+                    return nullptr;
+
+                real_rational<T> result;
+                switch (op) {
+                    case OPERATION::ADDITION:
+                        result = *lhs_rational + *rhs_rational;
+                        break;
+                    case OPERATION::SUBTRACTION:
+                        result = *lhs_rational - *rhs_rational;
+                        break;
+                    default:
+                        result = *lhs_rational * *rhs_rational;
+                        break;
+                }
+
+                if (result.is_integer())
+                    return node_table<T>::make(real_explicit<T>(result.numerator()));
+
+                return node_table<T>::make(std::move(result));
+            }
+
+            // Builds the node of the unary operation op (NEGATE, ABS or SCALE by base^n) of x, folded if
+            // possible: explicit and rational numbers are transformed exactly, and chains of these operations
+            // collapse, as -(-x) = x, |-x| = |x|, ||x|| = |x| and (x * base^n) * base^m = x * base^(n + m).
+            // Throws boost::real::exponent_overflow_exception if the power of the base of a SCALE, combined
+            // or not, does not fit half the range of the exponents, so the shifted bounds cannot overflow.
+            static std::shared_ptr<real_data<T>> unary_operation(const std::shared_ptr<real_data<T>>& x, OPERATION op,
+                                                                 long n) {
+                using exponent_t = typename exact_number<T>::exponent_t;
+                if (op == OPERATION::SCALE &&
+                    (n > std::numeric_limits<exponent_t>::max() / 2 || n < std::numeric_limits<exponent_t>::min() / 2))
+                    throw boost::real::exponent_overflow_exception();
+
+                if (op == OPERATION::SCALE && (n == 0 || is_explicit_zero(*x)))
+                    return x;
+
+                if (auto operation = std::get_if<real_operation<T>>(&x->get_real_number())) {
+                    OPERATION inner = operation->get_operation();
+                    if (op == OPERATION::NEGATE && inner == OPERATION::NEGATE)
+                        return operation->lhs();
+                    if (op == OPERATION::ABS && inner == OPERATION::NEGATE)
+                        return unary_operation(operation->lhs(), OPERATION::ABS, 0);
+                    if (op == OPERATION::ABS && inner == OPERATION::ABS)
+                        return x;
+                    if (op == OPERATION::SCALE && inner == OPERATION::SCALE)
+                        return unary_operation(operation->lhs(), OPERATION::SCALE, operation->exponent() + n);
+                }
+
+                std::optional<real_rational<T>> rational = rational_of(*x);
+                if (!rational)
+                    return node_table<T>::make(real_operation<T>(x, op, n));
+
+                exact_number<T> numerator = rational->numerator();
+                exact_number<T> denominator = rational->denominator();
+                switch (op) {
+                    case OPERATION::NEGATE:
+                        numerator.positive = !numerator.positive;
+                        break;
+                    case OPERATION::ABS:
+                        numerator.positive = true;
+                        break;
+                    default: // the integers are multiplied by base^n
+                        if (n > 0)
+                            numerator.exponent += (exponent_t) n;
+                        else
+                            denominator.exponent -= (exponent_t) n;
+                        break;
+                }
+
+                real_rational<T> result(numerator, denominator, op == OPERATION::SCALE);
+                if (result.is_integer())
+                    return node_table<T>::make(real_explicit<T>(result.numerator()));
+
+                return node_table<T>::make(std::move(result));
+            }
+
+            // x as a rational number if it is a rational or an explicit number
+            static std::optional<real_rational<T>> rational_of(const real_data<T>& x) {
+                if (auto rational_ptr = std::get_if<real_rational<T>>(&x.get_real_number()))
+                    return *rational_ptr;
+
+                if (auto explicit_ptr = std::get_if<real_explicit<T>>(&x.get_real_number()))
+                    return real_rational<T>(explicit_ptr->get_exact_number(), exact_number<T>(std::vector<T>{1}, 1));
+
+                return std::nullopt;
+            }
+
+            // number of operands of the balanced run of op that x is the root of: 1 if x is not an op
+            // operation, 0 if it is but the run below it is not balanced
+            static size_t balanced_operands(const real_data<T>& x, OPERATION op) {
+                auto operation_ptr = std::get_if<real_operation<T>>(&x.get_real_number());
+                if (operation_ptr == nullptr || operation_ptr->get_operation() != op)
+                    return 1;
+
+                return operation_ptr->balanced_operands();
+            }
+
+            // Builds the node of the operation lhs op rhs, folded if possible. Additions and multiplications
+            // are associative, so their runs are rebuilt as they grow, the way a binary counter carries: a
+            // run is a left spine of balanced subtrees of decreasing size, and appending an operand merges
+            // it with the subtrees of its same size. a = a + b in a loop then builds a tree of logarithmic
+            // depth, in amortized constant time per operand. The replaced nodes are not modified.
+            static std::shared_ptr<real_data<T>> make_operation(std::shared_ptr<real_data<T>> lhs,
+                                                                std::shared_ptr<real_data<T>> rhs, OPERATION op) {
+                if (std::shared_ptr<real_data<T>> folded = fold(lhs, rhs, op))
+                    return folded;
+
+                size_t carry_operands = balanced_operands(*rhs, op);
+                if ((op != OPERATION::ADDITION && op != OPERATION::MULTIPLICATION) || carry_operands == 0)
+                    return node_table<T>::make(real_operation<T>(lhs, rhs, op));
+
+                std::shared_ptr<real_data<T>> carry = rhs;
+                std::shared_ptr<real_data<T>> rest = lhs;
+
+                while (rest != nullptr) {
+                    size_t rest_operands = balanced_operands(*rest, op);
+
+                    if (rest_operands == carry_operands) { // the whole run merges with the carry
+                        carry = node_table<T>::make(real_operation<T>(rest, carry, op, 2 * carry_operands));
+                        carry_operands *= 2;
+                        rest = nullptr;
+                    } else if (rest_operands == 0) { // a spine node, its rhs is the smallest balanced subtree
+                        auto spine = std::get_if<real_operation<T>>(&rest->get_real_number());
+                        std::shared_ptr<real_data<T>> smallest = spine->rhs();
+
+                        if (balanced_operands(*smallest, op) != carry_operands)
+                            break;
+
+                        carry = node_table<T>::make(real_operation<T>(smallest, carry, op, 2 * carry_operands));
+                        carry_operands *= 2;
+                        rest = spine->lhs();
+                    } else {
+                        break;
+                    }
+                }
+
+                if (rest == nullptr)
+                    return carry;
+
+                return node_table<T>::make(real_operation<T>(rest, carry, op, 0));
+            }
+
+            // Adds operand to the n-ary operation op (SUM or PRODUCT) held by node, or starts one with both.
+            // An operand that is the same n-ary operation contributes its operands, so chains of += and *=
+            // flatten into a single node. The node is appended to in place if no other number or node
+            // shares it, and copied otherwise.
+            static std::shared_ptr<real_data<T>> accumulate(std::shared_ptr<real_data<T>>& node,
+                                                            const std::shared_ptr<real_data<T>>& operand, OPERATION op) {
+                std::vector<std::shared_ptr<real_data<T>>> appended;
+                auto operand_operation = std::get_if<real_operation<T>>(&operand->get_real_number());
+                if (operand_operation != nullptr && operand_operation->get_operation() == op) {
+                    for (size_t i = 0; i < operand_operation->operand_count(); i++)
+                        appended.push_back(operand_operation->operand(i));
+                } else {
+                    appended.push_back(operand);
+                }
+
+                std::vector<std::shared_ptr<real_data<T>>> operands;
+                auto operation = std::get_if<real_operation<T>>(&node->get_real_number());
+                if (operation != nullptr && operation->get_operation() == op) {
+                    if (node.use_count() == 1) {
+                        for (std::shared_ptr<real_data<T>>& x : appended)
+                            node->append(std::move(x));
+                        return node;
+                    }
+
+                    operands.reserve(operation->operand_count() + appended.size());
+                    for (size_t i = 0; i < operation->operand_count(); i++)
+                        operands.push_back(operation->operand(i));
+                } else {
+                    operands.push_back(node);
+                }
+
+                operands.insert(operands.end(), appended.begin(), appended.end());
+                return node_table<T>::make(real_operation<T>(std::move(operands), op));
+            }
+
             // this is used to control the amount of recursion that goes on in the distribution. Essentially, when we do a + b, we may 
             // look at one level below them (if applicable, i.e., they're operations pointing to operands of their own). 
 
@@ -324,6 +836,16 @@ namespace boost {
                 // We could do comparison by value, but this may force more computation than is necessary for the user,
                 // since it's difficult to determine whether values are the same
 
+                // folding comes first: a + a of an explicit a is better calculated than distributed
+                if (std::shared_ptr<real_data<T>> folded = fold(this->_real_p, other._real_p, op)) {
+                    if (assign_and_return_void) {
+                        this->_real_p = folded;
+                        return std::make_pair(true, std::nullopt);
+                    } else {
+                        return std::make_pair(true, real<T>(folded));
+                    }
+                }
+
                 std::shared_ptr<real_data<T>> a;
                 std::shared_ptr<real_data<T>> b;
                 std::shared_ptr<real_data<T>> x;
@@ -383,10 +905,10 @@ namespace boost {
                             }
 
                             if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION));
+                                this->_real_p = make_operation(a_op_b._real_p, x, OPERATION::MULTIPLICATION);
                                 return std::make_pair(true, std::nullopt);
                             } else {
-                                return std::make_pair(true, real(real_operation<T>(a_op_b._real_p, x, OPERATION::MULTIPLICATION)));
+                                return std::make_pair(true, real<T>(make_operation(a_op_b._real_p, x, OPERATION::MULTIPLICATION)));
                             }
                         }
                     } else { // lhs is an operation, but rhs is not an operation
@@ -433,10 +955,10 @@ namespace boost {
                             }
 
                             if(assign_and_return_void) {
-                                this->_real_p = std::make_shared<real_data<T>>(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
+                                this->_real_p = make_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION);
                                 return std::make_pair(true, std::nullopt);
                             } else {
-                                return std::make_pair(true, real(real_operation<T>(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
+                                return std::make_pair(true, real<T>(make_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
                             }
                         } 
                     }
@@ -484,21 +1006,21 @@ namespace boost {
                         }
 
                         if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION));
+                            this->_real_p = make_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION);
                             return std::make_pair(true, std::nullopt);
                         } else {
-                            return std::make_pair(true, real(real_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
+                            return std::make_pair(true, real<T>(make_operation(x_op_1._real_p, a, OPERATION::MULTIPLICATION)));
                         }
                     }
                 } else { // neither is an operation
                     if ((this->_real_p == other._real_p) && (op == OPERATION::ADDITION)) { // a + a = 2 * a
-                        std::shared_ptr<real_data<T>> two = std::make_shared<real_data<T>>(real_explicit<T>("2"));
+                        std::shared_ptr<real_data<T>> two = node_table<T>::make(real_explicit<T>("2"));
 
                         if(assign_and_return_void) {
-                            this->_real_p = std::make_shared<real_data<T>>(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION));
+                            this->_real_p = make_operation(two, this->_real_p, OPERATION::MULTIPLICATION);
                             return std::make_pair(true, std::nullopt);
                         } else {
-                            return std::make_pair(true, real(real_operation(two, this->_real_p, OPERATION::MULTIPLICATION)));
+                            return std::make_pair(true, real<T>(make_operation(two, this->_real_p, OPERATION::MULTIPLICATION)));
                         }
                     } 
                 } 
@@ -517,7 +1039,7 @@ namespace boost {
                         if (!is_simplified) {
                             real ret = (*this);
                             ret._real_p = 
-                                std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
+                                make_operation(this->_real_p, other._real_p, op);
                             return ret;
                         } else {
                             return result.value();
@@ -528,7 +1050,7 @@ namespace boost {
                     case RECURSION_LEVEL::ZERO: {
                         real ret = (*this);
                         ret._real_p = 
-                            std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, op));
+                            make_operation(this->_real_p, other._real_p, op);
                         return ret;
                         break;
                     }
@@ -561,7 +1083,7 @@ namespace boost {
                 
                 if (!is_simplified) {
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, OPERATION::ADDITION));
+                        accumulate(this->_real_p, other._real_p, OPERATION::SUM);
                 }
             }
 
@@ -577,7 +1099,7 @@ namespace boost {
                 if (is_simplified)  {
                     return result.value();
                 } else {
-                    return real<T>(real_operation<T>(this->_real_p, other._real_p, OPERATION::ADDITION));
+                    return real<T>(make_operation(this->_real_p, other._real_p, OPERATION::ADDITION));
                 }
             }
 
@@ -592,7 +1114,7 @@ namespace boost {
 
                 if(!is_simplified) {
                     this->_real_p = 
-                        std::make_shared<real_data<T>>(real_operation(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
+                        make_operation(this->_real_p, other._real_p, OPERATION::SUBTRACTION);
                 }
             }
 
@@ -608,10 +1130,21 @@ namespace boost {
                 if (is_simplified)  {
                     return result.value();
                 } else {
-                    return real(real_operation<T>(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
+                    return real<T>(make_operation(this->_real_p, other._real_p, OPERATION::SUBTRACTION));
                 }
             }
 
+            /**
+             * @brief Creates a new boost::real::real representing -(*this). It is a NEGATE node, which
+             * flips the bounds of its operand without calculating any digit. Explicit and rational numbers
+             * are negated exactly, and the negation of a negation is its operand.
+             *
+             * @return A copy of the new boost::real::real number representation.
+             */
+            real operator-() const {
+                return real<T>(unary_operation(this->_real_p, OPERATION::NEGATE, 0));
+            }
+
             /**
              * @brief Sets this real_data to that of the operation between 
              * this previous real_data and other real_data.
@@ -619,8 +1152,12 @@ namespace boost {
              * @param other - the right side operand boost::real::real number.
              */
             void operator*=(real<T> other) {
-                this->_real_p =
-                    std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
+                if (std::shared_ptr<real_data<T>> folded = fold(this->_real_p, other._real_p, OPERATION::MULTIPLICATION)) {
+                    this->_real_p = folded;
+                } else {
+                    this->_real_p =
+                        accumulate(this->_real_p, other._real_p, OPERATION::PRODUCT);
+                }
             }
 
             /**
@@ -631,7 +1168,7 @@ namespace boost {
              * @return A copy of the new boost::real::real number representation.
              */
             real<T> operator*(real<T> other) {
-                return real(real_operation<T>(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
+                return real<T>(make_operation(this->_real_p, other._real_p, OPERATION::MULTIPLICATION));
             }
 
             /**
@@ -653,7 +1190,7 @@ namespace boost {
              */
             void operator/=(real<T> other) {
                 this->_real_p =
-                    std::make_shared<real_data<T>>(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
+                    node_table<T>::make(real_operation<T>(this->_real_p, other._real_p, OPERATION::DIVISION));
             }
 
             /**
@@ -670,51 +1207,108 @@ namespace boost {
              */
             void operator=(const std::string& number) {
                 this->_real_p =
-                    std::make_shared<real_data<T>>(real_explicit<T>(number));
+                    node_table<T>::make(real_explicit<T>(number));
             }
 
             /**
-             * @brief Compares the *this boost::real::real number against the other boost::real::real number to
-             * determine if the number represented by *this is lower than the number represented by other.
-             * If the maximum precision is reached and the operator was not yet able to determine
-             * the value of the result, a precision_exception is thrown.
+             * @brief Three-way comparison between the *this boost::real::real number and the other
+             * boost::real::real number. The double precision intervals that enclose both numbers are
+             * compared first, then the double-double and the fixed precision ones, and only if they
+             * overlap both numbers are refined together, once, until their approximation intervals stop
+             * overlapping, both of them are fully represented, or the maximum precision is reached.
              *
              * @param other - a boost::real::real number to compare against.
-             * @return a bool that is true if *this < other and false in other cases.
+             * @return ORDERING::LESS, ORDERING::EQUAL or ORDERING::GREATER if the order between both
+             * numbers could be determined, ORDERING::UNDECIDED if the intervals still overlap once the
+             * maximum precision is reached.
+             */
+            ORDERING compare(const real<T>& other) const {
+                return refine_and_compare(other, nullptr);
+            }
+
+            /**
+             * @brief Non throwing version of compare(). It also reports the width of the widest
+             * approximation interval reached, so callers can handle undecided comparisons without
+             * exceptions.
              *
-             * @throws boost::real::precision_exception
+             * @param other - a boost::real::real number to compare against.
+             * @return a boost::real::comparison_result with the ordering and the interval width.
              */
-            bool operator<(const real<T>& other) const {
-                auto this_it = this->_real_p->get_precision_itr().cbegin();
-                auto other_it = other._real_p->get_precision_itr().cbegin();
+            comparison_result<T> try_compare(const real<T>& other) const {
+                comparison_result<T> result;
+                result.ordering = refine_and_compare(other, &result.width);
+                return result;
+            }
 
-                if (this_it == other_it)
-                    return false;
+            /**
+             * @brief Non throwing version of operator<.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return a boost::real::predicate_result whose value is empty if it is unknown
+             * whether *this < other when the maximum precision is reached.
+             */
+            predicate_result<T> try_less(const real<T>& other) const {
+                predicate_result<T> result;
+                ORDERING ordering = refine_and_compare(other, &result.width);
 
-                unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                for (unsigned int p = 0; p < current_precision; ++p) {
-                    // Get more precision
-                    ++this_it;
-                    ++other_it;
+                if (ordering != ORDERING::UNDECIDED)
+                    result.value = (ordering == ORDERING::LESS);
 
-                    bool this_full_precision = this_it.get_interval().is_a_number();
-                    bool other_full_precision = other_it.get_interval().is_a_number();
-                    if (this_full_precision && other_full_precision) {
-                        return this_it.get_interval() < other_it.get_interval();
-                    }
+                return result;
+            }
 
-                    if (this_it.get_interval()< other_it.get_interval()) {
-                        return true;
-                    }
+            /**
+             * @brief Non throwing version of operator==.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return a boost::real::predicate_result whose value is empty if it is unknown
+             * whether *this == other when the maximum precision is reached.
+             */
+            predicate_result<T> try_equal(const real<T>& other) const {
+                predicate_result<T> result;
+                ORDERING ordering = refine_and_compare(other, &result.width);
 
-                    if (other_it.get_interval()< this_it.get_interval()) {
-                        return false;
-                    }
+                if (ordering != ORDERING::UNDECIDED)
+                    result.value = (ordering == ORDERING::EQUAL);
+
+                return result;
+            }
+
+#if defined(__cpp_impl_three_way_comparison) && __cpp_impl_three_way_comparison >= 201907L
+            /**
+             * @brief C++20 three-way comparison operator. It is built on top of compare(), an
+             * undecided comparison is reported as std::partial_ordering::unordered.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return a std::partial_ordering with the order between *this and other.
+             */
+            std::partial_ordering operator<=>(const real<T>& other) const {
+                switch (compare(other)) {
+                    case ORDERING::LESS:
+                        return std::partial_ordering::less;
+                    case ORDERING::GREATER:
+                        return std::partial_ordering::greater;
+                    case ORDERING::EQUAL:
+                        return std::partial_ordering::equivalent;
+                    default:
+                        return std::partial_ordering::unordered;
                 }
+            }
+#endif
 
-                // If the precision is reached and the number ranges still overlap, then we cannot
-                // know if they are equals or other is less than this and we throw an error.
-                throw boost::real::precision_exception();
+            /**
+             * @brief Compares the *this boost::real::real number against the other boost::real::real number to
+             * determine if the number represented by *this is lower than the number represented by other.
+             * If the maximum precision is reached and the operator was not yet able to determine
+             * the value of the result, a precision_exception is thrown.
+             *
+             * @param other - a boost::real::real number to compare against.
+             * @return a bool that is true if *this < other and false in other cases.
+             *
+             * @throws boost::real::precision_exception
+             */
+            bool operator<(const real<T>& other) const {
+                return decided_compare(other) == ORDERING::LESS;
             }
 
             /**
@@ -729,37 +1323,7 @@ namespace boost {
              * @throws boost::real::precision_exception
              */
             bool operator>(const real<T>& other) const {
-                auto this_it = this->_real_p->get_precision_itr().cbegin();
-                auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                if (this_it == other_it)
-                    return false;
-
-                unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                for (unsigned int p = 0; p < current_precision; ++p) {
-                    // Get more precision
-                    ++this_it;
-                    ++other_it;
-
-                    bool this_full_precision = this_it.get_interval().is_a_number();
-                    bool other_full_precision = other_it.get_interval().is_a_number();
-
-                    if (this_full_precision && other_full_precision) {
-                        return this_it.get_interval() > other_it.get_interval();
-                    }
-
-                    if (this_it.get_interval()> other_it.get_interval()) {
-                        return true;
-                    }
-
-                    if (other_it.get_interval()> this_it.get_interval()) {
-                        return false;
-                    }
-                }
-
-                // If the precision is reached and the number ranges still overlap, then we cannot
-                // know if they are equals or other is less than this and we throw an error.
-                throw boost::real::precision_exception();
+                return decided_compare(other) == ORDERING::GREATER;
             }
 
             /**
@@ -769,36 +1333,12 @@ namespace boost {
              * the value of the result, a precision_exception is thrown.
              *
              * @param other - a boost::real::real number to compare against.
-             * @return a bool that is true if *this < other and false in other cases.
+             * @return a bool that is true if *this == other and false in other cases.
              *
              * @throws boost::real::precision_exception
              */
             bool operator==(const real<T>& other) const {
-                auto this_it = _real_p->get_precision_itr().cbegin();
-                auto other_it = other._real_p->get_precision_itr().cbegin();
-
-                unsigned int current_precision = std::max(this->maximum_precision(), other.maximum_precision());
-                for (unsigned int p = 0; p < current_precision; ++p) {
-                    // Get more precision
-                    ++this_it;
-                    ++other_it;
-
-                    bool this_full_precision = this_it.get_interval().is_a_number();
-                    bool other_full_precision = other_it.get_interval().is_a_number();
-                    if (this_full_precision && other_full_precision) {
-                        return this_it.get_interval()== other_it.get_interval();
-                    }
-
-                    bool this_is_lower = this_it.get_interval()< other_it.get_interval();
-                    bool other_is_lower = other_it.get_interval()< this_it.get_interval();
-                    if (this_is_lower || other_is_lower) {
-                        return false;
-                    }
-                }
-
-                // If the precision is reached and the numbers full precision is not reached, then
-                // we cannot know if they are equals or not.
-                throw boost::real::precision_exception();
+                return decided_compare(other) == ORDERING::EQUAL;
             }
             /********* END OPERATORS *********/
 
@@ -814,7 +1354,118 @@ namespace boost {
                 return os;
             }
 
+            template <typename U>
+            friend real<U> pow(const real<U>& x, long exponent);
+
+            template <typename U>
+            friend real<U> dot(const std::vector<real<U>>& a, const std::vector<real<U>>& b);
+
+            template <typename U>
+            friend real<U> abs(const real<U>& x);
+
+            template <typename U>
+            friend real<U> scale(const real<U>& x, long n);
+
         }; // end real class
+
+        /**
+         * @brief Creates a new boost::real::real representing x raised to an integer exponent. It is a
+         * single POWER node, refined by squaring and multiplying, instead of a chain of exponent - 1
+         * products. Even powers of intervals that contain zero start at zero.
+         *
+         * @param x - the base.
+         * @param exponent - the exponent, a negative one gives the reciprocal of the power.
+         * @return A copy of the new boost::real::real number representation.
+         */
+        template <typename T>
+        real<T> pow(const real<T>& x, long exponent) {
+            if (exponent == 0 || real<T>::is_explicit_one(*x._real_p))
+                return real<T>(std::string("1"));
+
+            if (exponent == 1 || (exponent > 0 && real<T>::is_explicit_zero(*x._real_p)))
+                return x;
+
+            return real<T>(real_operation<T>(x._real_p, OPERATION::POWER, exponent));
+        }
+
+        /**
+         * @brief Creates a new boost::real::real representing the dot product of a and b, the sum of
+         * the products a[i] * b[i]. It is a single DOT node: the bounds of the products are added into
+         * one exact accumulator per bound, so only the operands are truncated, instead of every partial
+         * product and sum of a tree of additions and multiplications. The dot product of rational and
+         * explicit numbers is calculated exactly once.
+         *
+         * @param a - the first vector of operands.
+         * @param b - the second vector of operands, of the same size as a.
+         * @return A copy of the new boost::real::real number representation, zero if a and b are empty.
+         *
+         * @throws boost::real::invalid_representation_exception if a and b have different sizes.
+         */
+        template <typename T>
+        real<T> dot(const std::vector<real<T>>& a, const std::vector<real<T>>& b) {
+            if (a.size() != b.size())
+                throw boost::real::invalid_representation_exception();
+
+            if (a.empty())
+                return real<T>(std::string("0"));
+
+            if (a.size() == 1)
+                return real<T>(a[0]) * b[0];
+
+            bool exact = true;
+            for (size_t i = 0; i < a.size() && exact; i++)
+                exact = real<T>::rational_of(*a[i]._real_p) && real<T>::rational_of(*b[i]._real_p);
+
+            if (exact) {
+                real_rational<T> result = *real<T>::rational_of(*a[0]._real_p) * *real<T>::rational_of(*b[0]._real_p);
+                for (size_t i = 1; i < a.size(); i++)
+                    result = result + *real<T>::rational_of(*a[i]._real_p) * *real<T>::rational_of(*b[i]._real_p);
+
+                if (result.is_integer())
+                    return real<T>(real_explicit<T>(result.numerator()));
+                return real<T>(std::move(result));
+            }
+
+            // the operands are stored interleaved, a[0], b[0], a[1], b[1], ...
+            std::vector<std::shared_ptr<real_data<T>>> operands;
+            operands.reserve(2 * a.size());
+            for (size_t i = 0; i < a.size(); i++) {
+                operands.push_back(a[i]._real_p);
+                operands.push_back(b[i]._real_p);
+            }
+
+            return real<T>(real_operation<T>(std::move(operands), OPERATION::DOT));
+        }
+
+        /**
+         * @brief Creates a new boost::real::real representing the absolute value of x. It is an ABS node,
+         * which folds the bounds of its operand without calculating any digit: an interval containing
+         * zero starts at zero.
+         *
+         * @param x - the number.
+         * @return A copy of the new boost::real::real number representation.
+         */
+        template <typename T>
+        real<T> abs(const real<T>& x) {
+            return real<T>(real<T>::unary_operation(x._real_p, OPERATION::ABS, 0));
+        }
+
+        /**
+         * @brief Creates a new boost::real::real representing x * base^n, where base is the internal
+         * base of the digits, (max / 4) * 2 of T. It is a SCALE node, which shifts the exponents of the
+         * bounds of its operand without calculating any digit.
+         *
+         * @param x - the number.
+         * @param n - the power of the base, negative to divide by it.
+         * @return A copy of the new boost::real::real number representation.
+         *
+         * @throws boost::real::exponent_overflow_exception if n, or n added to the power of the base of x
+         * if x is scaled itself, does not fit half the range of the exponents of the digits.
+         */
+        template <typename T>
+        real<T> scale(const real<T>& x, long n) {
+            return real<T>(real<T>::unary_operation(x._real_p, OPERATION::SCALE, n));
+        }
     }
 }
 
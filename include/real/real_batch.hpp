@@ -0,0 +1,487 @@
+#ifndef BOOST_REAL_REAL_BATCH_HPP
+#define BOOST_REAL_REAL_BATCH_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <real/comparison.hpp>
+#include <real/double_interval.hpp>
+#include <real/real.hpp>
+#include <real/real_exception.hpp>
+#include <real/real_operation.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Opt-in evaluator of one expression over a batch of inputs. The expression is built once
+         * on placeholders (see real::placeholder), and each lane of the batch gives a number to each of
+         * them.
+         *
+         * @details The nodes of the expression that depend on the placeholders are linearized in a tape,
+         * as in boost::real::real_tape, and the others become constants. The double intervals of every
+         * node are kept in structure of arrays layout, one contiguous array of lanes per node and side,
+         * so each operation runs as a branch free loop over all the lanes, which the compiler vectorizes.
+         * The results are rounded outwards by at least an ulp, so they enclose the exact ones as the
+         * double intervals of the comparisons do. The lanes whose double intervals do not decide a
+         * comparison are evaluated exactly, by binding the placeholders of the expression to their inputs.
+         *
+         * A batch must not be used by several threads at once.
+         */
+        template <typename T = int>
+        class real_batch {
+            enum class KIND {CONSTANT, INPUT, OPERATION};
+
+            struct instruction {
+                KIND kind;
+                OPERATION operation;
+                // operands of an operation, or index of the placeholder of an input
+                size_t lhs;
+                size_t rhs;
+                // enclosure of a constant
+                double_interval constant;
+            };
+
+            real<T> _expression;
+            std::vector<real<T>> _placeholders;
+            std::vector<instruction> _instructions;
+
+            // slot of the expression
+            size_t _result = 0;
+
+            // inputs of the last evaluation, _inputs[k][lane] is bound to the k-th placeholder
+            std::vector<std::vector<real<T>>> _inputs;
+            size_t _lanes = 0;
+
+            // sides of the interval of the node i in lane j, at i * _lanes + j
+            std::vector<double> _lower;
+            std::vector<double> _upper;
+
+            static constexpr double INFINITE = std::numeric_limits<double>::infinity();
+
+            // |x| * 2^-52 + the smallest denormal is at least an ulp of x, so subtracting it from a rounded
+            // to nearest result moves it below the exact one, even after rounding the subtraction.
+            // Undefined results (0 * infinity, infinity - infinity, a divisor containing zero) are NaN
+            // and give the whole real line.
+            static void widen(double* lower, double* upper, size_t lanes) {
+                const double epsilon = std::numeric_limits<double>::epsilon();
+                const double minimum = std::numeric_limits<double>::denorm_min();
+
+                for (size_t i = 0; i < lanes; i++) {
+                    double l = lower[i] - (std::abs(lower[i]) * epsilon + minimum);
+                    double u = upper[i] + (std::abs(upper[i]) * epsilon + minimum);
+                    bool undefined = l != l || u != u;
+                    lower[i] = undefined ? -INFINITE : l;
+                    upper[i] = undefined ? INFINITE : u;
+                }
+            }
+
+            static void add(const double* lhs_lower, const double* lhs_upper, const double* rhs_lower,
+                            const double* rhs_upper, double* lower, double* upper, size_t lanes) {
+                for (size_t i = 0; i < lanes; i++) {
+                    lower[i] = lhs_lower[i] + rhs_lower[i];
+                    upper[i] = lhs_upper[i] + rhs_upper[i];
+                }
+            }
+
+            static void subtract(const double* lhs_lower, const double* lhs_upper, const double* rhs_lower,
+                                 const double* rhs_upper, double* lower, double* upper, size_t lanes) {
+                for (size_t i = 0; i < lanes; i++) {
+                    lower[i] = lhs_lower[i] - rhs_upper[i];
+                    upper[i] = lhs_upper[i] - rhs_lower[i];
+                }
+            }
+
+            // the lowest and the highest of the four products of the sides, NaN if one of them is
+            static void multiply(const double* lhs_lower, const double* lhs_upper, const double* rhs_lower,
+                                 const double* rhs_upper, double* lower, double* upper, size_t lanes) {
+                const double nan = std::numeric_limits<double>::quiet_NaN();
+
+                for (size_t i = 0; i < lanes; i++) {
+                    double a = lhs_lower[i] * rhs_lower[i];
+                    double b = lhs_lower[i] * rhs_upper[i];
+                    double c = lhs_upper[i] * rhs_lower[i];
+                    double d = lhs_upper[i] * rhs_upper[i];
+                    bool undefined = a != a || b != b || c != c || d != d;
+                    lower[i] = undefined ? nan : std::min(std::min(a, b), std::min(c, d));
+                    upper[i] = undefined ? nan : std::max(std::max(a, b), std::max(c, d));
+                }
+            }
+
+            static void divide(const double* lhs_lower, const double* lhs_upper, const double* rhs_lower,
+                               const double* rhs_upper, double* lower, double* upper, size_t lanes) {
+                const double nan = std::numeric_limits<double>::quiet_NaN();
+
+                for (size_t i = 0; i < lanes; i++) {
+                    double a = lhs_lower[i] / rhs_lower[i];
+                    double b = lhs_lower[i] / rhs_upper[i];
+                    double c = lhs_upper[i] / rhs_lower[i];
+                    double d = lhs_upper[i] / rhs_upper[i];
+                    bool undefined = (rhs_lower[i] <= 0 && 0 <= rhs_upper[i]) ||
+                                     a != a || b != b || c != c || d != d;
+                    lower[i] = undefined ? nan : std::min(std::min(a, b), std::min(c, d));
+                    upper[i] = undefined ? nan : std::max(std::max(a, b), std::max(c, d));
+                }
+            }
+
+            static void negate(const double* lhs_lower, const double* lhs_upper, double* lower, double* upper,
+                               size_t lanes) {
+                for (size_t i = 0; i < lanes; i++) {
+                    lower[i] = -lhs_upper[i];
+                    upper[i] = -lhs_lower[i];
+                }
+            }
+
+            static void absolute(const double* lhs_lower, const double* lhs_upper, double* lower, double* upper,
+                                 size_t lanes) {
+                for (size_t i = 0; i < lanes; i++) {
+                    double l = lhs_lower[i];
+                    double u = lhs_upper[i];
+                    lower[i] = l > 0 ? l : (u < 0 ? -u : 0);
+                    upper[i] = std::max(-l, u);
+                }
+            }
+
+            // the nodes of the expression that depend on a placeholder
+            std::unordered_map<real_data<T>*, bool> dependent_nodes(
+                    const std::unordered_map<real_data<T>*, size_t>& inputs) const {
+                std::unordered_map<real_data<T>*, bool> dependent;
+                std::vector<std::pair<real_data<T>*, bool>> pending;
+                pending.push_back({_expression._real_p.get(), false});
+
+                while (!pending.empty()) {
+                    auto [node, operands_ready] = pending.back();
+
+                    if (dependent.find(node) != dependent.end()) { // shared operand, already walked
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    if (inputs.find(node) != inputs.end()) {
+                        pending.pop_back();
+                        dependent[node] = true;
+                        continue;
+                    }
+
+                    std::vector<real_data<T>*> operands = operands_of(*node);
+
+                    if (!operands_ready) {
+                        pending.back().second = true;
+                        for (real_data<T>* operand : operands)
+                            pending.push_back({operand, false});
+                        continue;
+                    }
+
+                    pending.pop_back();
+
+                    bool depends = false;
+                    for (real_data<T>* operand : operands)
+                        depends = depends || dependent[operand];
+                    dependent[node] = depends;
+                }
+
+                return dependent;
+            }
+
+            // the operands of an operation, or the number bound to a placeholder
+            static std::vector<real_data<T>*> operands_of(real_data<T>& node) {
+                if (auto operation = std::get_if<real_operation<T>>(&node.get_real_number())) {
+                    std::vector<real_data<T>*> operands;
+                    for (size_t i = 0; i < operation->operand_count(); i++)
+                        operands.push_back(operation->operand(i).get());
+                    return operands;
+                }
+
+                if (auto placeholder = std::get_if<real_placeholder<T>>(&node.get_real_number()))
+                    return {placeholder->value().get()};
+
+                return {};
+            }
+
+            // a POWER runs as the squarings and multiplications of its operand in slot x, and a negative one
+            // divides one by them. Returns the slot of the result.
+            size_t compile_power(size_t x, long exponent) {
+                size_t result = 0;
+                bool started = false;
+
+                for (unsigned long remaining = exponent < 0 ? -(unsigned long) exponent : exponent; remaining > 0; ) {
+                    if (remaining & 1) {
+                        if (started) {
+                            _instructions.push_back({KIND::OPERATION, OPERATION::MULTIPLICATION, result, x, {}});
+                            result = _instructions.size() - 1;
+                        } else {
+                            result = x;
+                            started = true;
+                        }
+                    }
+
+                    remaining >>= 1;
+                    if (remaining > 0) {
+                        _instructions.push_back({KIND::OPERATION, OPERATION::MULTIPLICATION, x, x, {}});
+                        x = _instructions.size() - 1;
+                    }
+                }
+
+                if (started && exponent > 0)
+                    return result;
+
+                _instructions.push_back({KIND::CONSTANT, OPERATION::ADDITION, 0, 0, double_interval(1, 1)});
+                size_t one = _instructions.size() - 1;
+                if (!started)
+                    return one;
+
+                _instructions.push_back({KIND::OPERATION, OPERATION::DIVISION, one, result, {}});
+                return _instructions.size() - 1;
+            }
+
+            // post-order walk of the nodes that depend on the placeholders, the other nodes are constants
+            void compile() {
+                std::unordered_map<real_data<T>*, size_t> inputs;
+                for (size_t k = 0; k < _placeholders.size(); k++)
+                    inputs[_placeholders[k]._real_p.get()] = k;
+
+                std::unordered_map<real_data<T>*, bool> dependent = dependent_nodes(inputs);
+                std::unordered_map<real_data<T>*, size_t> slot;
+                std::vector<std::pair<real_data<T>*, bool>> pending;
+                pending.push_back({_expression._real_p.get(), false});
+
+                while (!pending.empty()) {
+                    auto [node, operands_ready] = pending.back();
+
+                    if (slot.find(node) != slot.end()) { // shared operand, already in the tape
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    auto input = inputs.find(node);
+                    std::vector<real_data<T>*> operands = operands_of(*node);
+
+                    if (input == inputs.end() && dependent[node] && !operands_ready) {
+                        pending.back().second = true;
+                        for (auto operand = operands.rbegin(); operand != operands.rend(); ++operand)
+                            pending.push_back({*operand, false});
+                        continue;
+                    }
+
+                    pending.pop_back();
+
+                    if (input != inputs.end()) {
+                        slot[node] = _instructions.size();
+                        _instructions.push_back({KIND::INPUT, OPERATION::ADDITION, input->second, 0, {}});
+                    } else if (!dependent[node]) {
+                        slot[node] = _instructions.size();
+                        _instructions.push_back({KIND::CONSTANT, OPERATION::ADDITION, 0, 0, node->get_filter()});
+                    } else if (std::holds_alternative<real_placeholder<T>>(node->get_real_number())) {
+                        // a placeholder that is not an input stands for the number bound to it
+                        slot[node] = slot[operands.front()];
+                    } else if (auto operation = std::get_if<real_operation<T>>(&node->get_real_number());
+                               operation->get_operation() == OPERATION::POWER) {
+                        slot[node] = compile_power(slot[operands[0]], operation->exponent());
+                    } else if (operation->get_operation() == OPERATION::SCALE) {
+                        // a SCALE runs as a multiplication by the enclosure of base^exponent
+                        T base = (std::numeric_limits<T>::max() / 4) * 2;
+                        _instructions.push_back({KIND::CONSTANT, OPERATION::ADDITION, 0, 0,
+                                                 double_interval::from_digits(std::vector<T>{1},
+                                                                              (int) operation->exponent() + 1,
+                                                                              true, false, base)});
+                        _instructions.push_back({KIND::OPERATION, OPERATION::MULTIPLICATION, slot[operands[0]],
+                                                 _instructions.size() - 1, {}});
+                        slot[node] = _instructions.size() - 1;
+                    } else if (operation->is_unary()) {
+                        slot[node] = _instructions.size();
+                        _instructions.push_back({KIND::OPERATION, operation->get_operation(), slot[operands[0]],
+                                                 slot[operands[0]], {}});
+                    } else if (operation->get_operation() == OPERATION::DOT) {
+                        // a DOT runs as the products of the pairs of operands, added in a chain
+                        size_t accumulated = 0;
+                        for (size_t i = 0; i + 1 < operands.size(); i += 2) {
+                            _instructions.push_back({KIND::OPERATION, OPERATION::MULTIPLICATION,
+                                                     slot[operands[i]], slot[operands[i + 1]], {}});
+                            if (i > 0)
+                                _instructions.push_back({KIND::OPERATION, OPERATION::ADDITION, accumulated,
+                                                         _instructions.size() - 1, {}});
+                            accumulated = _instructions.size() - 1;
+                        }
+                        slot[node] = accumulated;
+                    } else if (operation->is_nary()) {
+                        // a SUM or PRODUCT runs as a chain of additions or multiplications of its operands
+                        OPERATION step = operation->get_operation() == OPERATION::SUM ?
+                                         OPERATION::ADDITION : OPERATION::MULTIPLICATION;
+                        size_t accumulated = slot[operands[0]];
+                        for (size_t i = 1; i < operands.size(); i++) {
+                            _instructions.push_back({KIND::OPERATION, step, accumulated, slot[operands[i]], {}});
+                            accumulated = _instructions.size() - 1;
+                        }
+                        slot[node] = accumulated;
+                    } else {
+                        slot[node] = _instructions.size();
+                        _instructions.push_back({KIND::OPERATION, operation->get_operation(),
+                                                 slot[operands[0]], slot[operands[1]], {}});
+                    }
+                }
+
+                _result = slot[_expression._real_p.get()];
+            }
+
+        public:
+            /**
+             * @brief Compiles expression for batches of inputs to placeholders.
+             *
+             * @param expression - the expression to evaluate.
+             * @param placeholders - the placeholders of expression given by each lane. Other placeholders
+             * keep the numbers bound to them.
+             *
+             * @throws boost::real::bad_variant_access_exception if a number in placeholders is not a placeholder.
+             */
+            real_batch(const real<T>& expression, std::vector<real<T>> placeholders)
+                    : _expression(expression), _placeholders(std::move(placeholders)) {
+                for (const real<T>& placeholder : _placeholders)
+                    if (!std::holds_alternative<real_placeholder<T>>(placeholder._real_p->get_real_number()))
+                        throw boost::real::bad_variant_access_exception();
+
+                compile();
+            }
+
+            /// number of nodes evaluated for each lane, the nodes that do not depend on the inputs are constants
+            size_t size() const {
+                return _instructions.size();
+            }
+
+            /// number of lanes of the last evaluated batch
+            size_t lanes() const {
+                return _lanes;
+            }
+
+            /**
+             * @brief Evaluates the double intervals of the expression for every lane of a batch.
+             *
+             * @param inputs - inputs[k][lane] is the number given to the k-th placeholder in the lane. Every
+             * placeholder must be given the same number of lanes.
+             *
+             * @throws boost::real::invalid_representation_exception if there is not a column of inputs for
+             * each placeholder, or if they have different numbers of lanes.
+             */
+            void evaluate(std::vector<std::vector<real<T>>> inputs) {
+                if (inputs.size() != _placeholders.size())
+                    throw boost::real::invalid_representation_exception();
+
+                size_t lanes = inputs.empty() ? 0 : inputs.front().size();
+                for (const std::vector<real<T>>& column : inputs)
+                    if (column.size() != lanes)
+                        throw boost::real::invalid_representation_exception();
+
+                _inputs = std::move(inputs);
+                _lanes = lanes;
+                _lower.assign(_instructions.size() * _lanes, 0);
+                _upper.assign(_instructions.size() * _lanes, 0);
+
+                for (size_t i = 0; i < _instructions.size(); i++) {
+                    const instruction& current = _instructions[i];
+                    double* lower = &_lower[i * _lanes];
+                    double* upper = &_upper[i * _lanes];
+
+                    switch (current.kind) {
+                        case KIND::CONSTANT:
+                            std::fill(lower, lower + _lanes, current.constant.lower);
+                            std::fill(upper, upper + _lanes, current.constant.upper);
+                            break;
+
+                        case KIND::INPUT:
+                            for (size_t lane = 0; lane < _lanes; lane++) {
+                                const double_interval& filter = _inputs[current.lhs][lane]._real_p->get_filter();
+                                lower[lane] = filter.lower;
+                                upper[lane] = filter.upper;
+                            }
+                            break;
+
+                        case KIND::OPERATION: {
+                            const double* lhs_lower = &_lower[current.lhs * _lanes];
+                            const double* lhs_upper = &_upper[current.lhs * _lanes];
+                            const double* rhs_lower = &_lower[current.rhs * _lanes];
+                            const double* rhs_upper = &_upper[current.rhs * _lanes];
+
+                            switch (current.operation) {
+                                case OPERATION::ADDITION:
+                                    add(lhs_lower, lhs_upper, rhs_lower, rhs_upper, lower, upper, _lanes);
+                                    break;
+                                case OPERATION::SUBTRACTION:
+                                    subtract(lhs_lower, lhs_upper, rhs_lower, rhs_upper, lower, upper, _lanes);
+                                    break;
+                                case OPERATION::MULTIPLICATION:
+                                    multiply(lhs_lower, lhs_upper, rhs_lower, rhs_upper, lower, upper, _lanes);
+                                    break;
+                                case OPERATION::DIVISION:
+                                    divide(lhs_lower, lhs_upper, rhs_lower, rhs_upper, lower, upper, _lanes);
+                                    break;
+                                case OPERATION::NEGATE:
+                                    negate(lhs_lower, lhs_upper, lower, upper, _lanes);
+                                    break;
+                                case OPERATION::ABS:
+                                    absolute(lhs_lower, lhs_upper, lower, upper, _lanes);
+                                    break;
+                                default: // n-ary operations, powers and scalings are compiled to binary ones
+                                    break;
+                            }
+
+                            // negations and absolute values are exact
+                            if (current.operation != OPERATION::NEGATE && current.operation != OPERATION::ABS)
+                                widen(lower, upper, _lanes);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            /// double interval that encloses the expression in lane
+            double_interval enclosure(size_t lane) const {
+                return double_interval(_lower[_result * _lanes + lane], _upper[_result * _lanes + lane]);
+            }
+
+            /**
+             * @brief Binds the placeholders of the expression to the inputs of lane, so the expression is
+             * the exact number of the lane.
+             *
+             * @return the expression.
+             */
+            const real<T>& bind(size_t lane) {
+                for (size_t k = 0; k < _placeholders.size(); k++)
+                    _expression.bind(_placeholders[k], _inputs[k][lane]);
+
+                return _expression;
+            }
+
+            /**
+             * @brief Three-way comparison of the expression in every lane with other. The lanes whose
+             * double intervals overlap the one of other are bound and compared exactly, as
+             * real::compare does.
+             *
+             * @return the ordering of each lane.
+             */
+            std::vector<ORDERING> compare(const real<T>& other) {
+                const double_interval& filter = other._real_p->get_filter();
+                const double* lower = &_lower[_result * _lanes];
+                const double* upper = &_upper[_result * _lanes];
+                std::vector<ORDERING> result(_lanes);
+
+                for (size_t lane = 0; lane < _lanes; lane++) {
+                    if (upper[lane] < filter.lower)
+                        result[lane] = ORDERING::LESS;
+                    else if (filter.upper < lower[lane])
+                        result[lane] = ORDERING::GREATER;
+                    else
+                        result[lane] = bind(lane).compare(other);
+                }
+
+                return result;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_BATCH_HPP
@@ -2,15 +2,28 @@
 #define BOOST_REAL_REAL_DATA_HPP
 
 #include <variant>
+#include <algorithm>
 #include <assert.h>
 #include <iostream>
 #include <limits>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <real/const_precision_iterator.hpp>
+#include <real/double_double_interval.hpp>
+#include <real/double_interval.hpp>
 #include <real/interval.hpp>
+#include <real/real_fixed.hpp>
 #include <real/real_explicit.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_operation.hpp>
+#include <real/real_placeholder.hpp>
+#include <real/reciprocal_cache.hpp>
 #include <real/real_exception.hpp>
 
 namespace boost { 
@@ -21,18 +34,327 @@ namespace boost {
             real_number<T> _real;
             const_precision_iterator<T> _precision_itr;
 
+            // double precision enclosure of the number, calculated once from the operands' ones when the
+            // node is created. It is the first stage of the comparisons (see real::refine_and_compare).
+            double_interval _filter;
+
+            // every copy of a real shares _precision_itr, so it is refined under this lock. Readers take
+            // it shared, the threads refining the iterator take it exclusively.
+            std::shared_mutex _mutex;
+
+            // double-double enclosure of the number, the second stage of the comparisons. It is only needed
+            // when the double intervals overlap, so it is calculated on demand. Guarded by _mutex.
+            std::optional<double_double_interval> _double_double_filter;
+
+            /// number of leading digits of the leaves used for the double intervals, enough for 53 bits
+            static constexpr size_t FILTER_DIGITS = 3;
+
+            /// number of leading digits of the leaves used for the double-double intervals, enough for 106 bits
+            static constexpr size_t DOUBLE_DOUBLE_FILTER_DIGITS = 4;
+
+            /// number of digits of the fixed precision enclosures, the third stage of the comparisons
+            static constexpr size_t FIXED_FILTER_LIMBS = 8;
+
+            // fixed precision enclosure of the number, calculated on demand when the double-double intervals
+            // overlap. Guarded by _mutex.
+            std::optional<real_fixed<T, FIXED_FILTER_LIMBS>> _fixed_filter;
+
+            // set by node_table when the node is interned: the table can hand it out again until it is removed
+            bool _interned = false;
+            friend class node_table<T>;
+
+            // interval of type I that encloses x. If x is an operation, operands enclose its operands.
+            template <typename I>
+            static I enclosure_of(const real_number<T>& x, size_t leading_digits, const std::vector<I>& operands = {}) {
+                // the digits go from 0 to (max / 4) * 2 - 1
+                T base = (std::numeric_limits<T>::max() / 4) * 2;
+
+                if (auto explicit_number = std::get_if<real_explicit<T>>(&x)) {
+                    const std::vector<T>& digits = explicit_number->digits();
+                    size_t leading = std::min(digits.size(), leading_digits);
+
+                    return I::from_digits(std::vector<T>(digits.begin(), digits.begin() + leading),
+                                          explicit_number->exponent(), explicit_number->positive(),
+                                          leading < digits.size(), base);
+                }
+
+                if (auto algorithm_number = std::get_if<real_algorithm<T>>(&x)) {
+                    std::vector<T> digits;
+                    for (size_t i = 0; i < leading_digits; i++)
+                        digits.push_back((*algorithm_number)[i]);
+
+                    return I::from_digits(digits, algorithm_number->exponent(), algorithm_number->positive(), true, base);
+                }
+
+                if (auto rational_number = std::get_if<real_rational<T>>(&x)) {
+                    return I::from_digits(rational_number->leading_digits(leading_digits), rational_number->exponent(),
+                                          rational_number->positive(), !rational_number->exact_within(leading_digits),
+                                          base);
+                }
+
+                if (auto placeholder = std::get_if<real_placeholder<T>>(&x))
+                    return placeholder->value()->template bound_enclosure<I>();
+
+                if (auto operation = std::get_if<real_operation<T>>(&x)) {
+                    switch (operation->get_operation()) {
+                        case OPERATION::ADDITION:
+                            return operands[0] + operands[1];
+                        case OPERATION::SUBTRACTION:
+                            return operands[0] - operands[1];
+                        case OPERATION::MULTIPLICATION:
+                            return operands[0] * operands[1];
+                        case OPERATION::DIVISION:
+                            return operands[0] / operands[1];
+                        case OPERATION::SUM: {
+                            I result = operands[0];
+                            for (size_t i = 1; i < operands.size(); i++)
+                                result = result + operands[i];
+                            return result;
+                        }
+                        case OPERATION::PRODUCT: {
+                            I result = operands[0];
+                            for (size_t i = 1; i < operands.size(); i++)
+                                result = result * operands[i];
+                            return result;
+                        }
+                        case OPERATION::POWER:
+                            return power_of(operands[0], operation->exponent(), base);
+                        case OPERATION::DOT: {
+                            I result = operands[0] * operands[1];
+                            for (size_t i = 2; i + 1 < operands.size(); i += 2)
+                                result = result + operands[i] * operands[i + 1];
+                            return result;
+                        }
+                        case OPERATION::NEGATE:
+                            return -operands[0];
+                        case OPERATION::ABS:
+                            return operands[0].abs();
+                        case OPERATION::SCALE:
+                            return operands[0] * I::from_digits(std::vector<T>{1}, (int) operation->exponent() + 1,
+                                                                true, false, base);
+                    }
+                }
+
+                return I();
+            }
+
+            // x^n of an interval of type I, by squaring and multiplying
+            template <typename I>
+            static I power_of(I x, long n, T base) {
+                I one = I::from_digits(std::vector<T>{1}, 1, true, false, base);
+                I result = one;
+
+                for (unsigned long remaining = n < 0 ? -(unsigned long) n : n; remaining > 0; ) {
+                    if (remaining & 1)
+                        result = result * x;
+                    remaining >>= 1;
+                    if (remaining > 0)
+                        x = x * x;
+                }
+
+                return n < 0 ? one / result : result;
+            }
+
+            // enclosure of type I of the number, as the enclosure of a placeholder bound to it
+            template <typename I>
+            I bound_enclosure() {
+                if constexpr (std::is_same_v<I, double_interval>)
+                    return _filter;
+                else if constexpr (std::is_same_v<I, double_double_interval>)
+                    return get_double_double_filter();
+                else if constexpr (std::is_same_v<I, real_fixed<T, FIXED_FILTER_LIMBS>>)
+                    return get_fixed_filter();
+                else
+                    return enclosure<I::LIMBS>();
+            }
+
+            static double_interval filter_of(const real_number<T>& x) {
+                if (auto operation = std::get_if<real_operation<T>>(&x)) {
+                    std::vector<double_interval> operands;
+                    operands.reserve(operation->operand_count());
+                    for (size_t i = 0; i < operation->operand_count(); i++)
+                        operands.push_back(operation->operand(i)->_filter);
+
+                    return enclosure_of(x, FILTER_DIGITS, operands);
+                }
+
+                return enclosure_of<double_interval>(x, FILTER_DIGITS);
+            }
+
+            template <typename I>
+            std::optional<I> cached_filter(const std::optional<I>& filter) {
+                std::shared_lock<std::shared_mutex> lock(_mutex);
+                return filter;
+            }
+
+            /**
+             * @brief Enclosure of type I of the number, with leading_digits digits of the leaves. The tree
+             * is walked with an explicit stack: known(node) returns the enclosure of node if it was
+             * already calculated, and keep(node, enclosure) stores the new ones.
+             */
+            template <typename I, typename Known, typename Keep>
+            I walk_enclosure(size_t leading_digits, Known known, Keep keep) {
+                if (std::optional<I> cached = known(this))
+                    return *cached;
+
+                std::vector<std::pair<real_data<T>*, bool>> pending;
+                pending.push_back({this, false});
+
+                while (!pending.empty()) {
+                    auto [node, operands_ready] = pending.back();
+                    auto operation = std::get_if<real_operation<T>>(&node->_real);
+
+                    if (known(node)) { // shared operand, already calculated
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    if (operation && !operands_ready) {
+                        pending.back().second = true;
+                        for (size_t i = 0; i < operation->operand_count(); i++)
+                            pending.push_back({operation->operand(i).get(), false});
+                        continue;
+                    }
+
+                    pending.pop_back();
+
+                    std::vector<I> operands;
+                    if (operation) {
+                        operands.reserve(operation->operand_count());
+                        for (size_t i = 0; i < operation->operand_count(); i++)
+                            operands.push_back(*known(operation->operand(i).get()));
+                    }
+                    keep(node, enclosure_of<I>(node->_real, leading_digits, operands));
+                }
+
+                return *known(this);
+            }
+
+            /// the enclosure kept in the filter member of every node, calculated for the nodes that miss it
+            template <typename I>
+            I cached_enclosure(std::optional<I> real_data<T>::* filter, size_t leading_digits) {
+                return walk_enclosure<I>(
+                    leading_digits,
+                    [filter] (real_data<T>* node) { return node->cached_filter(node->*filter); },
+                    [filter] (real_data<T>* node, const I& enclosure) {
+                        std::unique_lock<std::shared_mutex> lock(node->_mutex);
+                        node->*filter = enclosure;
+                    });
+            }
+
+            // the nodes x is calculated from: the operands of an operation or the number bound to a placeholder
+            static std::vector<real_data<T>*> operands_of(const real_number<T>& x) {
+                std::vector<real_data<T>*> result;
+
+                if (auto operation = std::get_if<real_operation<T>>(&x)) {
+                    result.reserve(operation->operand_count());
+                    for (size_t i = 0; i < operation->operand_count(); i++)
+                        result.push_back(operation->operand(i).get());
+                } else if (auto placeholder = std::get_if<real_placeholder<T>>(&x)) {
+                    result.push_back(placeholder->value().get());
+                }
+
+                return result;
+            }
+
+            // moves the nodes x is calculated from into released, see ~real_data
+            static void release_operands(real_number<T>& x, std::vector<std::shared_ptr<real_data<T>>>& released) {
+                if (auto operation = std::get_if<real_operation<T>>(&x))
+                    operation->release_operands(released);
+                else if (auto placeholder = std::get_if<real_placeholder<T>>(&x))
+                    placeholder->release_operands(released);
+            }
+
+            /// true if node is this one or is reached from its operands
+            bool depends_on(const real_data<T>* node) {
+                std::unordered_map<real_data<T>*, bool> visited;
+                std::vector<real_data<T>*> pending = {this};
+
+                while (!pending.empty()) {
+                    real_data<T>* current = pending.back();
+                    pending.pop_back();
+
+                    if (current == node)
+                        return true;
+
+                    if (!visited.emplace(current, true).second)
+                        continue;
+
+                    for (real_data<T>* operand : operands_of(current->_real))
+                        if (operand != nullptr)
+                            pending.push_back(operand);
+                }
+
+                return false;
+            }
+
+            /**
+             * @brief Calculates the iterator and the enclosures of the node again from its operands, as
+             * when it was built. The maximum precision set for the node is kept.
+             */
+            void reset() {
+                std::unique_lock<std::shared_mutex> lock(_mutex);
+
+                if (auto operation = std::get_if<real_operation<T>>(&_real))
+                    operation->clear_intervals();
+
+                precision_t maximum_precision = _precision_itr._maximum_precision;
+                _precision_itr = const_precision_iterator<T>(&_real);
+                _precision_itr._maximum_precision = maximum_precision;
+
+                _filter = filter_of(_real);
+                _double_double_filter.reset();
+                _fixed_filter.reset();
+            }
+
             public:
             /// @TODO: use move constructors, if possible
             
-            real_data() = default;
+            real_data() {
+                _precision_itr._mutex = &_mutex;
+            }
             
             /// copy ctor - constructs real_data from other real_data
-            real_data(const real_data<T> &other) : _real(other._real), _precision_itr(other._precision_itr) {};
+            real_data(const real_data<T> &other) : _real(other._real), _precision_itr(other._precision_itr), _filter(other._filter) {
+                _precision_itr._mutex = &_mutex;
+            };
 
             // construct from the three different reals 
-            real_data(real_explicit<T> x) :_real(x), _precision_itr(&_real) {};
-            real_data(real_algorithm<T> x) : _real(x), _precision_itr(&_real) {};
-            real_data(real_operation<T> x) : _real(x), _precision_itr(&_real) {};
+            real_data(real_explicit<T> x) :_real(x), _precision_itr(&_real), _filter(filter_of(_real)) {
+                _precision_itr._mutex = &_mutex;
+            };
+            real_data(real_algorithm<T> x) : _real(x), _precision_itr(&_real), _filter(filter_of(_real)) {
+                _precision_itr._mutex = &_mutex;
+            };
+            real_data(real_operation<T> x) : _real(x), _precision_itr(&_real), _filter(filter_of(_real)) {
+                _precision_itr._mutex = &_mutex;
+            };
+            real_data(real_placeholder<T> x) : _real(x), _precision_itr(&_real), _filter(filter_of(_real)) {
+                _precision_itr._mutex = &_mutex;
+            };
+            real_data(real_rational<T> x) : _real(x), _precision_itr(&_real), _filter(filter_of(_real)) {
+                _precision_itr._mutex = &_mutex;
+            };
+
+            /**
+             * @brief *Destructor:* releasing an operation would release its operands recursively, so
+             * long operation chains are unlinked first. Operands only owned by this tree are moved to a
+             * worklist and freed one by one after their own operands were moved out. An interned operand
+             * is first removed from the node_table, so no other thread can look it up while it is unlinked.
+             */
+            ~real_data() {
+                std::vector<std::shared_ptr<real_data<T>>> released;
+                release_operands(_real, released);
+
+                while (!released.empty()) {
+                    std::shared_ptr<real_data<T>> operand = std::move(released.back());
+                    released.pop_back();
+
+                    if (operand.use_count() == 1 && (!operand->_interned || node_table<T>::remove(operand)))
+                        release_operands(operand->_real, released);
+                    // operand is freed here, it has no operands left so this does not recurse
+                }
+            }
 
             const real_number<T>& get_real_number() const {
                 return _real;
@@ -45,77 +367,298 @@ namespace boost {
             const_precision_iterator<T>& get_precision_itr() {
                 return _precision_itr;
             }
+
+            /// double precision interval that encloses the number, it only changes when a placeholder is bound
+            const double_interval& get_filter() const {
+                return _filter;
+            }
+
+            /**
+             * @brief Double-double interval that encloses the number. The first call calculates it for
+             * the number and the operands that miss it, and keeps it for later calls.
+             */
+            double_double_interval get_double_double_filter() {
+                return cached_enclosure(&real_data<T>::_double_double_filter, DOUBLE_DOUBLE_FILTER_DIGITS);
+            }
+
+            /**
+             * @brief Fixed precision interval that encloses the number. The first call calculates it for
+             * the number and the operands that miss it, and keeps it for later calls.
+             */
+            real_fixed<T, FIXED_FILTER_LIMBS> get_fixed_filter() {
+                return cached_enclosure(&real_data<T>::_fixed_filter, FIXED_FILTER_LIMBS);
+            }
+
+            /**
+             * @brief Fixed precision interval with Limbs digits that encloses the number, calculated from
+             * the leading digits of the leaves. Nothing is refined.
+             */
+            template <size_t Limbs>
+            real_fixed<T, Limbs> enclosure() {
+                std::unordered_map<real_data<T>*, real_fixed<T, Limbs>> enclosures;
+
+                return walk_enclosure<real_fixed<T, Limbs>>(
+                    Limbs,
+                    [&enclosures] (real_data<T>* node) {
+                        auto it = enclosures.find(node);
+                        return it == enclosures.end() ? std::optional<real_fixed<T, Limbs>>() :
+                                                        std::optional<real_fixed<T, Limbs>>(it->second);
+                    },
+                    [&enclosures] (real_data<T>* node, const real_fixed<T, Limbs>& enclosure) {
+                        enclosures.emplace(node, enclosure);
+                    });
+            }
+
+            /// the lock guarding get_precision_itr()
+            std::shared_mutex& get_mutex() {
+                return _mutex;
+            }
+
+            /**
+             * @brief Appends operand to the SUM or PRODUCT held by this node. The interval at the current
+             * precision and the double interval are updated with the ones of operand, instead of being
+             * calculated again from every operand, so a sum built by appending costs constant time per
+             * term. The other cached intervals and enclosures are dropped. The node must not be shared.
+             *
+             * @throws boost::real::bad_variant_access_exception if the node is not a SUM or a PRODUCT.
+             */
+            void append(std::shared_ptr<real_data<T>> operand) {
+                auto operation = std::get_if<real_operation<T>>(&_real);
+                if (operation == nullptr || !operation->is_nary() || operation->get_operation() == OPERATION::DOT)
+                    throw boost::real::bad_variant_access_exception();
+
+                std::unique_lock<std::shared_mutex> lock(_mutex);
+                precision_t precision = _precision_itr._precision;
+                precision_t maximum_precision = _precision_itr.maximum_precision();
+
+                interval<T> operand_interval;
+                {
+                    const_precision_iterator<T>& operand_itr = operand->get_precision_itr();
+                    std::unique_lock<std::shared_mutex> operand_lock = operand_itr.lock();
+                    if (operand_itr._precision < precision)
+                        operand_itr.iterate_n_times(precision - operand_itr._precision);
+                    operand_interval = operand_itr._approximation_interval;
+                }
+
+                interval<T>& current = _precision_itr._approximation_interval;
+                if (operation->get_operation() == OPERATION::SUM) {
+                    current.lower_bound = current.lower_bound + operand_interval.lower_bound.up_to(precision, false);
+                    current.upper_bound = current.upper_bound + operand_interval.upper_bound.up_to(precision, true);
+                    _filter = _filter + operand->_filter;
+                } else {
+                    current = const_precision_iterator<T>::operation_boundaries(OPERATION::MULTIPLICATION, current,
+                                                                                operand_interval, precision,
+                                                                                maximum_precision);
+                    _filter = _filter * operand->_filter;
+                }
+
+                operation->append(std::move(operand));
+                operation->cache_interval(precision, maximum_precision, current);
+                _double_double_filter.reset();
+                _fixed_filter.reset();
+            }
+
+            /**
+             * @brief Binds placeholder to value and invalidates the nodes of this tree that depend on it:
+             * their cached intervals and enclosures are calculated again from the lowest precision, as
+             * when they were built. The nodes that do not depend on placeholder keep theirs.
+             *
+             * @throws boost::real::bad_variant_access_exception if placeholder is not a placeholder.
+             * @throws boost::real::invalid_representation_exception if value depends on placeholder.
+             */
+            void bind(real_data<T>& placeholder, std::shared_ptr<real_data<T>> value) {
+                auto bound = std::get_if<real_placeholder<T>>(&placeholder._real);
+                if (bound == nullptr)
+                    throw boost::real::bad_variant_access_exception();
+
+                if (value->depends_on(&placeholder))
+                    throw boost::real::invalid_representation_exception();
+
+                {
+                    std::unique_lock<std::shared_mutex> lock(placeholder._mutex);
+                    bound->bind(std::move(value));
+                }
+                placeholder.reset();
+
+                // post-order walk with an explicit stack: a node depends on placeholder if an operand does,
+                // so its operands are reset before it
+                std::unordered_map<real_data<T>*, bool> dependent;
+                dependent[&placeholder] = true;
+
+                std::vector<std::pair<real_data<T>*, bool>> pending;
+                pending.push_back({this, false});
+
+                while (!pending.empty()) {
+                    auto [node, operands_ready] = pending.back();
+
+                    if (dependent.find(node) != dependent.end()) { // shared operand, already walked
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    std::vector<real_data<T>*> operands = operands_of(node->_real);
+
+                    if (!operands_ready) {
+                        pending.back().second = true;
+                        for (real_data<T>* operand : operands)
+                            if (operand != nullptr)
+                                pending.push_back({operand, false});
+                        continue;
+                    }
+
+                    pending.pop_back();
+
+                    bool depends = false;
+                    for (real_data<T>* operand : operands)
+                        depends = depends || (operand != nullptr && dependent[operand]);
+
+                    dependent[node] = depends;
+                    if (depends)
+                        node->reset();
+                }
+            }
         };
 
         // Now that real_data and const_precision_iterator have been defined, we may now define the following.
         // Note these are all inline to avoid linker issues.
 
         /* const_precision_iterator member functions */
-        /// determines a real_operation's approximation interval from its operands'
+        /// determines a real_operation's approximation interval, reusing the one cached for this precision if any
         template <typename T>
         inline void const_precision_iterator<T>::update_operation_boundaries(real_operation<T> &ro) {
-            switch (ro.get_operation()) {
+            if (ro.cached_interval(_precision, this->maximum_precision(), this->_approximation_interval))
+                return;
+
+            calculate_operation_boundaries(ro);
+            ro.cache_interval(_precision, this->maximum_precision(), this->_approximation_interval);
+        }
+
+        /// determines a real_operation's approximation interval from its operands'
+        template <typename T>
+        inline void const_precision_iterator<T>::calculate_operation_boundaries(real_operation<T> &ro) {
+            if (ro.is_nary()) {
+                std::vector<interval<T>> operands;
+                operands.reserve(ro.operand_count());
+                for (size_t i = 0; i < ro.operand_count(); i++)
+                    operands.push_back(ro.get_operand_itr(i).snapshot());
+
+                this->_approximation_interval = nary_boundaries(ro.get_operation(), operands, _precision,
+                                                                this->maximum_precision());
+                return;
+            }
+
+            // the operands may be refined by other threads meanwhile, so their intervals are copied once
+            interval<T> lhs = ro.get_lhs_itr().snapshot();
+
+            if (ro.is_unary()) {
+                // a negative power divides by the operand, which is iterated like a divisor
+                if (ro.get_operation() == OPERATION::POWER && ro.exponent() < 0) {
+                    while (!lhs.positive() &&
+                           !lhs.negative() &&
+                           _precision <= this->maximum_precision()) {
+                        ++(*this);
+                        lhs = ro.get_lhs_itr().snapshot();
+                    }
+                }
+
+                this->_approximation_interval = unary_boundaries(ro.get_operation(), lhs, ro.exponent(), _precision,
+                                                                 this->maximum_precision());
+                return;
+            }
+
+            interval<T> rhs = ro.get_rhs_itr().snapshot();
+
+            if (ro.get_operation() == OPERATION::DIVISION) {
+                // if the interval contains zero, iterate until it doesn't, or until maximum_precision.
+                while (!rhs.positive() &&
+                       !rhs.negative() &&
+                       _precision <= this->maximum_precision()) {
+                    ++(*this);
+                    lhs = ro.get_lhs_itr().snapshot();
+                    rhs = ro.get_rhs_itr().snapshot();
+                }
+            }
+
+            this->_approximation_interval = operation_boundaries(ro.get_operation(), lhs, rhs, _precision,
+                                                                 this->maximum_precision());
+        }
+
+        template <typename T>
+        inline interval<T> const_precision_iterator<T>::operation_boundaries(OPERATION operation,
+                                                                             const interval<T>& lhs,
+                                                                             const interval<T>& rhs,
+                                                                             precision_t precision,
+                                                                             precision_t maximum_precision) {
+            interval<T> result;
+
+            switch (operation) {
                 case OPERATION::ADDITION:
-                    this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) +
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                    result.lower_bound =
+                            lhs.lower_bound.up_to(precision, false) +
+                            rhs.lower_bound.up_to(precision, false);
 
-                    this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) +
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                    result.upper_bound =
+                            lhs.upper_bound.up_to(precision, true) +
+                            rhs.upper_bound.up_to(precision, true);
                     break;
 
 
                 case OPERATION::SUBTRACTION:
-                    this->_approximation_interval.lower_bound =
-                            ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) -
-                            ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                    result.lower_bound =
+                            lhs.lower_bound.up_to(precision, false) -
+                            rhs.upper_bound.up_to(precision, true);
 
-                    this->_approximation_interval.upper_bound =
-                            ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) -
-                            ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                    result.upper_bound =
+                            lhs.upper_bound.up_to(precision, true) -
+                            rhs.lower_bound.up_to(precision, false);
                     break;
 
                 case OPERATION::MULTIPLICATION: {
-                    bool lhs_positive = ro.get_lhs_itr().get_interval().positive();
-                    bool rhs_positive = ro.get_rhs_itr().get_interval().positive();
-                    bool lhs_negative = ro.get_lhs_itr().get_interval().negative();
-                    bool rhs_negative = ro.get_rhs_itr().get_interval().negative();
+                    if (ball_arithmetic) {
+                        ball<T> product = ball<T>(lhs).up_to(precision) * ball<T>(rhs).up_to(precision);
+                        result = product.to_interval();
+                        break;
+                    }
+
+                    bool lhs_positive = lhs.positive();
+                    bool rhs_positive = rhs.positive();
+                    bool lhs_negative = lhs.negative();
+                    bool rhs_negative = rhs.negative();
 
                     if (lhs_positive && rhs_positive) { // Positive - Positive
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        result.lower_bound =
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.lower_bound.up_to(precision, false);
 
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                        result.upper_bound =
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.upper_bound.up_to(precision, true);
 
                     } else if (lhs_negative && rhs_negative) { // Negative - Negative
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                        result.lower_bound =
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.upper_bound.up_to(precision, true);
 
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        result.upper_bound =
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.lower_bound.up_to(precision, false);
                     } else if (lhs_negative && rhs_positive) { // Negative - Positive
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                        result.lower_bound =
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.upper_bound.up_to(precision, true);
 
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        result.upper_bound =
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.lower_bound.up_to(precision, false);
 
                     } else if (lhs_positive && rhs_negative) { // Positive - Negative
-                        this->_approximation_interval.lower_bound =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        result.lower_bound =
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.lower_bound.up_to(precision, false);
 
-                        this->_approximation_interval.upper_bound =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                        result.upper_bound =
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.upper_bound.up_to(precision, true);
 
                     } else { // One is around zero all possible combinations are be tested
 
@@ -123,49 +666,49 @@ namespace boost {
 
                         // Lower * Lower
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.lower_bound.up_to(precision, false);
 
-                        this->_approximation_interval.lower_bound = current_boundary;
-                        this->_approximation_interval.upper_bound = current_boundary;
+                        result.lower_bound = current_boundary;
+                        result.upper_bound = current_boundary;
 
                         // Upper * upper
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.upper_bound.up_to(precision, true);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound) {
-                            this->_approximation_interval.lower_bound.up_to(_precision, false) = current_boundary;
+                        if (current_boundary < result.lower_bound) {
+                            result.lower_bound.up_to(precision, false) = current_boundary;
                         }
 
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
+                        if (result.upper_bound < current_boundary) {
+                            result.upper_bound = current_boundary;
                         }
 
                         // Lower * upper
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false) *
-                                ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                                lhs.lower_bound.up_to(precision, false) *
+                                rhs.upper_bound.up_to(precision, true);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
-                            this->_approximation_interval.lower_bound = current_boundary;
+                        if (current_boundary < result.lower_bound.up_to(precision, false)) {
+                            result.lower_bound = current_boundary;
                         }
 
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
+                        if (result.upper_bound < current_boundary) {
+                            result.upper_bound = current_boundary;
                         }
 
                         // Upper * lower
                         current_boundary =
-                                ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true) *
-                                ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                                lhs.upper_bound.up_to(precision, true) *
+                                rhs.lower_bound.up_to(precision, false);
 
-                        if (current_boundary < this->_approximation_interval.lower_bound.up_to(_precision, false)) {
-                            this->_approximation_interval.lower_bound = current_boundary;
+                        if (current_boundary < result.lower_bound.up_to(precision, false)) {
+                            result.lower_bound = current_boundary;
                         }
 
-                        if (this->_approximation_interval.upper_bound < current_boundary) {
-                            this->_approximation_interval.upper_bound = current_boundary;
+                        if (result.upper_bound < current_boundary) {
+                            result.upper_bound = current_boundary;
                         }
                     }
                     break;
@@ -178,113 +721,136 @@ namespace boost {
                     exact_number<T> numerator;
                     exact_number<T> denominator;
 
-                    // if the interval contains zero, iterate until it doesn't, or until maximum_precision.
-                    while (!ro.get_rhs_itr().get_interval().positive() &&
-                           !ro.get_rhs_itr().get_interval().positive() &&
-                           _precision <= this->maximum_precision())
-                        ++(*this);
-
                     // if the interval contains zero after iterating until max precision, throw,
                     // because this causes one side of the result interval to tend towards +/-infinity
-                    if (!ro.get_rhs_itr().get_interval().positive() &&
-                        !ro.get_rhs_itr().get_interval().negative())
+                    if (!rhs.positive() &&
+                        !rhs.negative())
                         throw boost::real::divergent_division_result_exception();
 
+                    // an exact divisor is replaced by its cached reciprocal, the quotient is a product then
+                    if (reciprocal_cache<T>::enabled && rhs.is_a_number()) {
+                        interval<T> reciprocal = reciprocal_cache<T>::reciprocal(rhs.lower_bound, maximum_precision);
+                        std::vector<exact_number<T>> products;
+                        for (const exact_number<T>& boundary : {lhs.lower_bound.up_to(precision, false),
+                                                                lhs.upper_bound.up_to(precision, true)})
+                            for (const exact_number<T>& factor : {reciprocal.lower_bound, reciprocal.upper_bound}) {
+                                products.push_back(boundary * factor);
+                                products.back().normalize();
+                            }
+
+                        result.lower_bound = *std::min_element(products.begin(), products.end());
+                        result.upper_bound = *std::max_element(products.begin(), products.end());
+                        result.lower_bound = result.lower_bound.up_to(maximum_precision, false);
+                        result.upper_bound = result.upper_bound.up_to(maximum_precision, true);
+                        break;
+                    }
+
+                    // the quotient of two numbers only needs one division with intervals too
+                    if (ball_arithmetic && !(lhs.is_a_number() && rhs.is_a_number())) {
+                        // a divisor close to zero may not fit in a ball that excludes it, it is done with intervals then
+                        ball<T> divisor = ball<T>(rhs).up_to(precision);
+                        if (!divisor.contains_zero()) {
+                            ball<T> quotient = ball<T>(lhs).up_to(precision).divide(divisor, maximum_precision);
+                            result = quotient.to_interval();
+                            break;
+                        }
+                    }
+
                     // Q = N/D
                     // first, the upper boundary
-                    if (ro.get_lhs_itr().get_interval().positive()) {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true);
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                    if (lhs.positive()) {
+                        if (rhs.positive()) {
+                            numerator = lhs.upper_bound.up_to(precision, true);
+                            denominator = rhs.lower_bound.up_to(precision, false);
                         } else {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.upper_bound.up_to(precision, true);
                         }
-                    } else if (ro.get_lhs_itr().get_interval().negative()) {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true);
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                        } else if (ro.get_rhs_itr().get_interval().negative()) {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
+                    } else if (lhs.negative()) {
+                        if (rhs.positive()) {
+                            numerator = lhs.upper_bound.up_to(precision, true);
+                            denominator = rhs.lower_bound.up_to(precision, false);
+                        } else if (rhs.negative()) {
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.upper_bound.up_to(precision, true);
                         }
                     } else {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound.up_to(_precision, true);
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound.up_to(_precision, true);
-                        } else if (ro.get_rhs_itr().get_interval().negative()) {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                        if (rhs.positive()) {
+                            numerator = lhs.upper_bound.up_to(precision, true);
+                            denominator = rhs.upper_bound.up_to(precision, true);
+                        } else if (rhs.negative()) {
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.lower_bound.up_to(precision, false);
                         }
                     }
 
                     // calculate the upper bound
                     quotient = numerator;
-                    quotient.divide_vector(denominator, this->maximum_precision());
+                    quotient.divide_vector(denominator, maximum_precision);
 
                     residual = quotient * denominator - numerator;
                     residual.normalize();
                     quotient.normalize();
 
-                    this->_approximation_interval.upper_bound = quotient;
+                    result.upper_bound = quotient;
 
                     if (residual.abs() > zero) {
-                        this->_approximation_interval.upper_bound.round_up(base);
+                        result.upper_bound.round_up(base);
                     }
                     // if both operands are numbers (not intervals), then we can skip doing the lower bound separately
-                    if (ro.get_rhs_itr().get_interval().is_a_number() &&
-                        ro.get_lhs_itr().get_interval().is_a_number()) {
-                        _approximation_interval.lower_bound = quotient;
+                    if (rhs.is_a_number() &&
+                        lhs.is_a_number()) {
+                        result.lower_bound = quotient;
                         if (residual == zero) {
-                            _approximation_interval.upper_bound = _approximation_interval.lower_bound;
+                            result.upper_bound = result.lower_bound;
                         } else {
-                            _approximation_interval.lower_bound.round_down(base);
+                            result.lower_bound.round_down(base);
                         }
-                        return;
+                        return result;
                     }
 
                     // lower boundary
-                    if (ro.get_lhs_itr().get_interval().positive()) {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound;
+                    if (lhs.positive()) {
+                        if (rhs.positive()) {
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.upper_bound;
                         } else {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound;
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                            numerator = lhs.upper_bound;
+                            denominator = rhs.lower_bound.up_to(precision, false);
                         }
-                    } else if (ro.get_lhs_itr().get_interval().negative()) {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound;
-                        } else if (ro.get_rhs_itr().get_interval().negative()) {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound;
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
+                    } else if (lhs.negative()) {
+                        if (rhs.positive()) {
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.upper_bound;
+                        } else if (rhs.negative()) {
+                            numerator = lhs.upper_bound;
+                            denominator = rhs.lower_bound.up_to(precision, false);
                         }
                     } else {
-                        if (ro.get_rhs_itr().get_interval().positive()) {
-                            numerator = ro.get_lhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                            denominator = ro.get_rhs_itr().get_interval().lower_bound.up_to(_precision, false);
-                        } else if (ro.get_rhs_itr().get_interval().negative()) {
-                            numerator = ro.get_lhs_itr().get_interval().upper_bound;
-                            denominator = ro.get_rhs_itr().get_interval().upper_bound;
+                        if (rhs.positive()) {
+                            numerator = lhs.lower_bound.up_to(precision, false);
+                            denominator = rhs.lower_bound.up_to(precision, false);
+                        } else if (rhs.negative()) {
+                            numerator = lhs.upper_bound;
+                            denominator = rhs.upper_bound;
                         }
                     }
 
                     quotient = numerator;
-                    quotient.divide_vector(denominator, this->maximum_precision());
+                    quotient.divide_vector(denominator, maximum_precision);
 
                     residual = quotient * denominator - numerator;
                     residual.normalize();
                     quotient.normalize();
 
-                    this->_approximation_interval.lower_bound = quotient;
+                    result.lower_bound = quotient;
 
                     if (residual.abs() > zero) {
-                        this->_approximation_interval.lower_bound.round_down(base);
+                        result.lower_bound.round_down(base);
                     }
 
-                    if (this->_approximation_interval.lower_bound > this->_approximation_interval.upper_bound)
-                        this->_approximation_interval.swap_bounds();
+                    if (result.lower_bound > result.upper_bound)
+                        result.swap_bounds();
 
                     break;
                 }
@@ -292,41 +858,368 @@ namespace boost {
                 default:
                     throw boost::real::none_operation_exception();
             }
+
+            return result;
         }
 
         template <typename T>
-        inline void const_precision_iterator<T>::operation_iterate_n_times(real_operation<T> &ro, int n) {
-            /// @warning there could be issues if operands have different precisions/max precisions
+        inline interval<T> const_precision_iterator<T>::nary_boundaries(OPERATION operation,
+                                                                        const std::vector<interval<T>>& operands,
+                                                                        precision_t precision,
+                                                                        precision_t maximum_precision) {
+            interval<T> result;
+
+            switch (operation) {
+                case OPERATION::SUM:
+                    // one running sum per bound, the operands are only truncated once
+                    result.lower_bound = operands[0].lower_bound.up_to(precision, false);
+                    result.upper_bound = operands[0].upper_bound.up_to(precision, true);
+
+                    for (size_t i = 1; i < operands.size(); i++) {
+                        result.lower_bound = result.lower_bound + operands[i].lower_bound.up_to(precision, false);
+                        result.upper_bound = result.upper_bound + operands[i].upper_bound.up_to(precision, true);
+                    }
+                    break;
 
-            if (ro.get_lhs_itr()._precision < this->_precision + n) {
-                ro.get_lhs_itr().iterate_n_times(n);
+                case OPERATION::PRODUCT:
+                    result = operands[0];
+                    for (size_t i = 1; i < operands.size(); i++)
+                        result = operation_boundaries(OPERATION::MULTIPLICATION, result, operands[i], precision,
+                                                      maximum_precision);
+                    break;
+
+                case OPERATION::DOT:
+                    // a single pass: the bounds of each product are added to one exact accumulator per
+                    // bound, only the operands are truncated to the precision
+                    result.lower_bound = exact_number<T>(std::vector<T>{0}, 0);
+                    result.upper_bound = result.lower_bound;
+
+                    for (size_t i = 0; i + 1 < operands.size(); i += 2) {
+                        interval<T> product = operation_boundaries(OPERATION::MULTIPLICATION, operands[i],
+                                                                   operands[i + 1], precision, maximum_precision);
+                        result.lower_bound = result.lower_bound + product.lower_bound;
+                        result.upper_bound = result.upper_bound + product.upper_bound;
+                    }
+                    break;
+
+                default:
+                    throw boost::real::none_operation_exception();
             }
-            
-            if (ro.get_rhs_itr()._precision < this->_precision + n) {
-                ro.get_rhs_itr().iterate_n_times(n);
+
+            return result;
+        }
+
+        template <typename T>
+        inline interval<T> const_precision_iterator<T>::unary_boundaries(OPERATION operation,
+                                                                         const interval<T>& operand,
+                                                                         long exponent,
+                                                                         precision_t precision,
+                                                                         precision_t maximum_precision) {
+            interval<T> result;
+
+            switch (operation) {
+                case OPERATION::POWER: {
+                    interval<T> one;
+                    one.lower_bound = exact_number<T>(std::vector<T>{1}, 1);
+                    one.upper_bound = one.lower_bound;
+                    if (exponent == 0)
+                        return one;
+
+                    unsigned long n = exponent < 0 ? -(unsigned long) exponent : exponent;
+                    precision_t digits = std::max<precision_t>(precision, 1);
+
+                    // a product below base^-(maximum_precision + 1) is rounded outwards to 0 or to
+                    // base^-maximum_precision, so the exponents of the squares of a base below one stay bounded
+                    // and the power takes a logarithmic number of short products. The bounds of a negative
+                    // power are inverted, so they are not rounded to 0.
+                    exponent_t smallest = -(exponent_t) maximum_precision;
+                    auto bounded = [smallest, exponent] (exact_number<T>& x, bool upper) {
+                        if (exponent < 0 || x.digits.empty() || x.digits.front() == 0 || x.exponent >= smallest)
+                            return;
+
+                        if (upper)
+                            x = exact_number<T>(std::vector<T>{1}, smallest + 1);
+                        else
+                            x = exact_number<T>();
+                    };
+
+                    // |x|^n by squaring and multiplying, each product is rounded to the precision towards
+                    // the side of the bound it gives
+                    auto power = [n, digits, &bounded] (exact_number<T> x, bool upper, bool positive) {
+                        x = x.abs();
+                        x.normalize();
+                        exact_number<T> result(std::vector<T>{1}, 1);
+
+                        for (unsigned long remaining = n; remaining > 0; ) {
+                            if (remaining & 1) {
+                                result = result * x;
+                                result.normalize();
+                                result = result.up_to(digits, upper);
+                                bounded(result, upper);
+                            }
+                            remaining >>= 1;
+                            if (remaining > 0) {
+                                x = x * x;
+                                x.normalize();
+                                x = x.up_to(digits, upper);
+                                bounded(x, upper);
+                            }
+                        }
+
+                        result.positive = positive;
+                        result.normalize();
+                        return result;
+                    };
+
+                    exact_number<T> zero;
+                    const exact_number<T>& lower = operand.lower_bound;
+                    const exact_number<T>& upper = operand.upper_bound;
+                    bool odd = n % 2 == 1;
+
+                    if (!(lower < zero)) { // x^n grows with x
+                        result.lower_bound = power(lower, false, true);
+                        result.upper_bound = power(upper, true, true);
+                    } else if (!(zero < upper)) { // |x| decreases with x
+                        if (odd) {
+                            result.lower_bound = power(lower, true, false);
+                            result.upper_bound = power(upper, false, false);
+                        } else {
+                            result.lower_bound = power(upper, false, true);
+                            result.upper_bound = power(lower, true, true);
+                        }
+                    } else if (odd) {
+                        result.lower_bound = power(lower, true, false);
+                        result.upper_bound = power(upper, true, true);
+                    } else { // even powers of an interval containing zero start at zero
+                        exact_number<T> lhs = power(lower, true, true);
+                        exact_number<T> rhs = power(upper, true, true);
+                        result.lower_bound = exact_number<T>(std::vector<T>{0}, 0);
+                        result.upper_bound = (lhs < rhs) ? rhs : lhs;
+                    }
+
+                    if (exponent < 0)
+                        result = operation_boundaries(OPERATION::DIVISION, one, result, precision, maximum_precision);
+                    break;
+                }
+
+                // the bounds are moved, their signs flipped and their exponents shifted, no digit is calculated
+                case OPERATION::NEGATE:
+                    result.lower_bound = negated(operand.upper_bound);
+                    result.upper_bound = negated(operand.lower_bound);
+                    break;
+
+                case OPERATION::ABS:
+                    if (operand.positive()) {
+                        result = operand;
+                    } else if (operand.negative()) {
+                        result.lower_bound = negated(operand.upper_bound);
+                        result.upper_bound = negated(operand.lower_bound);
+                    } else {
+                        result.lower_bound = exact_number<T>(std::vector<T>{0}, 0);
+                        result.upper_bound = (operand.upper_bound < negated(operand.lower_bound)) ?
+                                             negated(operand.lower_bound) : operand.upper_bound;
+                    }
+                    break;
+
+                case OPERATION::SCALE:
+                    result.lower_bound = scaled(operand.lower_bound, (exponent_t) exponent);
+                    result.upper_bound = scaled(operand.upper_bound, (exponent_t) exponent);
+                    break;
+
+                default:
+                    throw boost::real::none_operation_exception();
             }
 
-            this->_precision += n;
+            return result;
+        }
+
+        template <typename T>
+        inline void const_precision_iterator<T>::operation_iterate_n_times(real_operation<T> &ro, int n) {
+            /// @warning there could be issues if operands have different precisions/max precisions
+
+            // The tree is walked in post-order with an explicit stack instead of recursing through
+            // iterate_n_times, so the depth of the tree is only bounded by the heap. Operations are
+            // told apart from leaves with std::get_if, leaves are iterated in place.
+            //
+            // The nodes below this one are shared, so each of them is locked from the moment its operands
+            // are pushed until its boundaries are updated. A thread only waits for the operands of the
+            // nodes it holds, so the locks held always form a path from this node and cannot deadlock.
+            struct pending_operation {
+                const_precision_iterator<T>* itr;
+                real_operation<T>* operation;
+                bool operands_ready;
+                std::unique_lock<std::shared_mutex> lock;
+            };
+
+            precision_t target = this->_precision + n;
+            std::vector<pending_operation> pending;
+            pending.push_back({this, &ro, false, {}});
 
-            update_operation_boundaries(ro);
+            while (!pending.empty()) {
+                pending_operation& current = pending.back();
+
+                if (current.operands_ready) {
+                    current.itr->_precision = target;
+                    current.itr->update_operation_boundaries(*current.operation);
+                    pending.pop_back(); // unlocks the node
+                    continue;
+                }
+
+                // operands shared with other parts of the tree, or refined by other threads, may already be
+                // at this precision. This is checked when they are reached, so a shared operand is iterated
+                // only once, and checked again once it is locked.
+                if (current.itr != this) {
+                    if (current.itr->current_precision() >= target) {
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    current.lock = current.itr->lock();
+                    if (current.itr->_precision >= target) {
+                        pending.pop_back();
+                        continue;
+                    }
+                }
+
+                current.operands_ready = true;
+                real_operation<T>* operation = current.operation; // current is invalidated by push_back
+                for (size_t i = 0; i < operation->operand_count(); i++) {
+                    const_precision_iterator<T>* operand = &operation->get_operand_itr(i);
+                    if (operand->current_precision() >= target)
+                        continue;
+
+                    if (auto operand_operation = std::get_if<real_operation<T>>(operand->_real_ptr)) {
+                        pending.push_back({operand, operand_operation, false, {}});
+                    } else {
+                        std::unique_lock<std::shared_mutex> lock = operand->lock();
+                        if (operand->_precision < target)
+                            operand->iterate_n_times(target - operand->_precision);
+                    }
+                }
+            }
         }
 
         template <typename T>
         inline void const_precision_iterator<T>::operation_iterate(real_operation<T> &ro) {
-            // only iterate if we must. If operand precision < this precision, then it must have
-            // hit its maximum_precision. If operand precision == this precision, we try iterating. Otherwise,
-            // it is == this->_precision + 1 (from being iterated elsewhere in the operation tree) and
-            // we do not iterate again.
+            operation_iterate_n_times(ro, 1);
+        }
 
-            if (ro.get_lhs_itr()._precision == this->_precision)
-                ++(ro.get_lhs_itr());
-            
-            if (ro.get_rhs_itr()._precision == this->_precision)
-                ++(ro.get_rhs_itr());
+        template <typename T>
+        inline bool const_precision_iterator<T>::iterate_operation_once(real_operation<T> &ro) {
+            if (this->_precision >= this->maximum_precision())
+                return false;
 
-            (this->_precision)++;
+            operation_iterate_n_times(ro, 1);
+            return true;
+        }
+
+        template <typename T>
+        inline bool const_precision_iterator<T>::plan_operation_refinement(real_operation<T> &ro,
+                                                                           const exact_number<T>& max_width,
+                                                                           refinement& step) {
+            if (ro.get_operation() == OPERATION::NEGATE || ro.get_operation() == OPERATION::ABS ||
+                ro.get_operation() == OPERATION::SCALE) {
+                // w(-x) = w(|x|) <= w(x) and w(x * base^n) = w(x) * base^n, so the operand alone is refined
+                exponent_t shift = ro.get_operation() == OPERATION::SCALE ? (exponent_t) ro.exponent() : 0;
+                step.operands.push_back({&ro.get_lhs_itr(), scaled(max_width, -shift)});
+                step.finish = FINISH::RECALCULATE;
+                return true;
+            }
+
+            if (ro.get_operation() == OPERATION::PRODUCT || ro.get_operation() == OPERATION::DOT || ro.is_unary()) {
+                // the error budgets of the factors depend on every other factor, so a product is refined
+                // one digit at a time instead. So are a power, the product of copies of its operand, and a
+                // sum of products
+                return iterate_operation_once(ro);
+            }
+
+            // base^e > max_width >= base^(e - 1). The operation rounds its operands to precision digits,
+            // with precision = magnitude - e + 2 each rounding is at most base^(e - 2), so all of them
+            // together stay far under max_width / 2. The other half is split between the operands.
+            exact_number<T> width = max_width;
+            width.normalize_left();
+            exponent_t e = width.exponent;
+
+            std::vector<std::pair<const_precision_iterator<T>*, exact_number<T>>>& budgets = step.operands;
+            exponent_t precision;
+
+            if (ro.get_operation() == OPERATION::SUM) {
+                // w(x_1 + ... + x_n) = w(x_1) + ... + w(x_n), each term is given max_width / 2^(k + 1),
+                // with 2^k >= n
+                unsigned int halvings = 1;
+                while (((size_t) 1 << (halvings - 1)) < ro.operand_count())
+                    ++halvings;
+
+                exact_number<T> budget = halved(max_width, halvings);
+                exponent_t magnitude = ZERO_MAGNITUDE;
+                for (size_t i = 0; i < ro.operand_count(); i++) {
+                    magnitude = std::max(magnitude, upper_magnitude(ro.get_operand_itr(i).snapshot()));
+                    budgets.push_back({&ro.get_operand_itr(i), budget});
+                }
+
+                // n roundings, with n lower than the base
+                precision = magnitude - e + 3;
+            } else {
+                // the operands are shared, they are read from copies and locked while they are refined
+                interval<T> lhs = ro.get_lhs_itr().snapshot();
+                interval<T> rhs = ro.get_rhs_itr().snapshot();
+
+                exponent_t lhs_magnitude = upper_magnitude(lhs);
+                exponent_t rhs_magnitude = upper_magnitude(rhs);
+
+                // each term of the result width is given a quarter of max_width. |x| < base^Ex is read from
+                // the current intervals, which can only shrink when the operands are refined.
+                exact_number<T> quarter = halved(max_width, 2);
+
+                switch (ro.get_operation()) {
+                    case OPERATION::ADDITION:
+                    case OPERATION::SUBTRACTION:
+                        // w(x +- y) = w(x) + w(y)
+                        budgets.push_back({&ro.get_lhs_itr(), quarter});
+                        budgets.push_back({&ro.get_rhs_itr(), quarter});
+                        precision = std::max(lhs_magnitude, rhs_magnitude) - e + 2;
+                        break;
+
+                    case OPERATION::MULTIPLICATION:
+                        // w(x * y) <= |x| w(y) + |y| w(x) + w(x) w(y)
+                        budgets.push_back({&ro.get_lhs_itr(), scaled(quarter, -rhs_magnitude)});
+                        budgets.push_back({&ro.get_rhs_itr(), scaled(quarter, -lhs_magnitude)});
+                        precision = lhs_magnitude + rhs_magnitude - e + 2;
+                        break;
 
-            update_operation_boundaries(ro);
+                    case OPERATION::DIVISION: {
+                        // the divisor must not contain zero to bound the quotient, the division iterates
+                        // until it does not
+                        if (!rhs.positive() && !rhs.negative())
+                            return iterate_operation_once(ro);
+
+                        // w(x / y) <= w(x) / |y| + |x| w(y) / |y|^2, with |y| >= base^(F - 1)
+                        exponent_t divisor_magnitude = lower_magnitude(rhs) - 1;
+                        budgets.push_back({&ro.get_lhs_itr(), scaled(quarter, divisor_magnitude)});
+                        budgets.push_back({&ro.get_rhs_itr(),
+                                           scaled(quarter, 2 * divisor_magnitude - lhs_magnitude)});
+                        precision = std::max(lhs_magnitude, lhs_magnitude + rhs_magnitude - divisor_magnitude) -
+                                    divisor_magnitude - e + 2;
+                        break;
+                    }
+
+                    default:
+                        throw boost::real::none_operation_exception();
+                }
+            }
+
+            // this is only called when the interval is still too wide, so at least one more digit is used.
+            // If the budget needs more digits than the maximum precision, the operation is iterated instead.
+            precision = std::max(precision, (exponent_t)this->_precision + 1);
+            if (precision > (exponent_t)this->maximum_precision()) {
+                budgets.clear();
+                return iterate_operation_once(ro);
+            }
+
+            // the operands are refined to their budgets by refine_to_width, then the operation is updated
+            step.precision = precision;
+            step.finish = FINISH::UPDATE;
+            return true;
         }
 
         /* real_operation member functions */
@@ -342,6 +1235,18 @@ namespace boost {
         inline const_precision_iterator<T>& real_operation<T>::get_rhs_itr() {
             return _rhs->get_precision_itr();
         }
+
+        template <typename T>
+        inline const_precision_iterator<T>& real_operation<T>::get_operand_itr(size_t i) {
+            return operand(i)->get_precision_itr();
+        }
+
+        /* real_placeholder member functions */
+
+        template <typename T>
+        inline const_precision_iterator<T>& real_placeholder<T>::get_value_itr() {
+            return _value->get_precision_itr();
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 #include <string>
 #include <regex>
 #include <limits>
+#include <utility>
 
 #include <real/real_exception.hpp>
 #include <real/interval.hpp>
@@ -27,6 +28,28 @@ namespace boost {
             // Number representation as a vector of digits with an integer part and a sign (+/-)
             // TODO: Add normalizations to the constructors
             exact_number<T> explicit_number;
+
+            // sets the digits to the integer written with the decimal digits of both parts, followed by
+            // zeros up to exponent decimal digits, changing base through decimal limbs.
+            void from_decimal_digits(std::string_view integer_part, std::string_view decimal_part, int exponent) {
+                std::string decimal;
+                decimal.reserve(std::max<size_t>(integer_part.size() + decimal_part.size(), std::max(exponent, 0)));
+                decimal += integer_part;
+                decimal += decimal_part;
+                if (exponent > (int)decimal.size())
+                    decimal.append(exponent - decimal.size(), '0');
+
+                std::vector<T> digits = exact_number<T>::digits_from_decimal(decimal);
+                explicit_number.exponent = (int)digits.size();
+
+                // trailing zeros are kept in the exponent
+                while (digits.size() > 1 && digits.back() == 0)
+                    digits.pop_back();
+
+                if (digits.empty())
+                    digits = {0};
+                explicit_number.digits = std::move(digits);
+            }
             
         public:
 
@@ -44,66 +67,13 @@ namespace boost {
             real_explicit<T>(const real_explicit<T>& other)  = default;
 
             constexpr explicit real_explicit(const std::string_view integer_part, const std::string_view decimal_part, int exponent, bool positive) {
-                exact_number<T> op;
                 explicit_number.positive = positive;
                 if (integer_part.empty() && decimal_part.empty()) {
                     explicit_number.digits = {0};
                     explicit_number.exponent = 0;
                     return;
                 }
-                explicit_number.exponent = exponent;
-                for (const auto& c : integer_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                for (const auto& c : decimal_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                //changing base below
-                exponent = 0;
-                //int b = 30;
-                T b = (std::numeric_limits<T>::max() /4)*2;
-                std::vector<T> base;
-                while (b!=0) {
-                    base.push_back(b%10);
-                    b /= 10;
-                }
-                std::reverse(base.begin(), base.end());
-                int curr_size = explicit_number.digits.size();
-                
-                for (int i = 0; i<explicit_number.exponent-curr_size; ++i) {
-                    explicit_number.digits.push_back(0);
-                }
-                
-                while (explicit_number.digits.size() > 1) {
-                    std::vector<T> quotient;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient);
-                    if (rem.empty()) {
-                        explicit_number.digits = quotient;
-                        ++exponent; 
-                    }
-                    else
-                        break;
-                }
-                
-                std::vector<T> new_digits;
-                while (!explicit_number.digits.empty()) {
-                    std::vector<T> quotient;
-                    //std::vector<T> rem;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient);
-                    T result = 0;
-                    for (auto d : rem)  
-                    {
-                        result = result * 10 + d;
-                    }
-                    
-                    new_digits.push_back(result);
-                    explicit_number.digits = quotient;
-                }
-                
-                std::reverse (new_digits.begin(), new_digits.end());
-                exponent += (int)new_digits.size();
-                explicit_number.digits = new_digits;
-                explicit_number.exponent = exponent;
+                from_decimal_digits(integer_part, decimal_part, exponent);
             }
             
             constexpr explicit real_explicit(std::string_view number) {
@@ -114,61 +84,8 @@ namespace boost {
                     explicit_number.exponent = 0;
                     return;
                 }
-                exact_number<T> op;
-                explicit_number.exponent = exponent;
-                for (const auto& c : integer_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
-                for (const auto& c : decimal_part ) {
-                    explicit_number.digits.push_back(c - '0');
-                }
                 explicit_number.positive = positive;
-
-                //changing base below.
-                exponent = 0;
-                T b = (std::numeric_limits<T>::max() /4)*2;
-                std::vector<T> base;
-                while (b!=0) {
-                    base.push_back(b%10);
-                    b /= 10;
-                }
-                std::reverse(base.begin(), base.end());
-                int curr_size = explicit_number.digits.size();
-                
-                for (int i = 0; i<explicit_number.exponent-curr_size; ++i) {
-                    explicit_number.digits.push_back(0);
-                }
-                
-                while (explicit_number.digits.size() > 1) {
-                    std::vector<T> quotient;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient);
-                    if (rem.empty()) {
-                        explicit_number.digits = quotient;
-                        ++exponent; 
-                    }
-                    else
-                        break;
-                }
-                
-                std::vector<T> new_digits;
-                while (!explicit_number.digits.empty()) {
-                    std::vector<T> quotient;
-                    //std::vector<T> rem;
-                    std::vector<T> rem = op.long_divide_vectors(explicit_number.digits, base, quotient);
-                    T result = 0;
-                    for (auto d : rem)  
-                    {
-                        result = result * 10 + d;
-                    }
-                    
-                    new_digits.push_back(result);
-                    explicit_number.digits = quotient;
-                }
-                
-                std::reverse (new_digits.begin(), new_digits.end());
-                exponent += (int)new_digits.size();
-                explicit_number.digits = new_digits;
-                explicit_number.exponent = exponent;
+                from_decimal_digits(integer_part, decimal_part, exponent);
             }           
 
             /**
@@ -199,6 +116,14 @@ namespace boost {
                                                                                 explicit_number(digits,exponent,positive)
             {};
 
+            /**
+             * @brief *Exact number constructor:* Creates a boost::real::real_explicit instance that
+             * represents the number. Used to build the result of operations calculated exactly.
+             *
+             * @param number - a normalized boost::real::exact_number in the internal base.
+             */
+            explicit real_explicit<T>(exact_number<T> number) : explicit_number(std::move(number)) {};
+
             /**
              * @return An integer with the number exponent
              */
@@ -0,0 +1,509 @@
+#ifndef BOOST_REAL_REAL_FIXED_HPP
+#define BOOST_REAL_REAL_FIXED_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <real/comparison.hpp>
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+#include <real/real_exception.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief An interval that encloses a number, with both boundaries kept with exactly Limbs digits
+         * of the boost::real internal base. It is meant for the computations that know at compile time
+         * how much precision they need: the boundaries are std::arrays, the operations never allocate
+         * and their loops have a compile time length.
+         *
+         * @details Every result is rounded outwards, so it encloses the exact result of the operation
+         * over the operand intervals. The default constructed boost::real::real_fixed is the whole real
+         * line, which is also the result of a division by an interval that contains zero: those
+         * intervals are not bounded() and decide nothing. A boost::real::real number is converted with
+         * boost::real::real::fixed.
+         *
+         * @tparam T - the digits type of the boost::real::real numbers it interoperates with.
+         * @tparam Limbs - the number of digits of each boundary.
+         */
+        template <typename T = int, size_t Limbs = 4>
+        class real_fixed {
+            static_assert(Limbs > 0, "boost::real::real_fixed needs at least one digit");
+
+            // the digits go from 0 to BASE - 1
+            static constexpr T BASE = (std::numeric_limits<T>::max() / 4) * 2;
+
+            // a type that holds the product of two digits plus two more digits
+#if defined(__SIZEOF_INT128__)
+            __extension__ typedef __int128 int128_t;
+            using wide_t = std::conditional_t<(std::numeric_limits<T>::digits <= 31), long long, int128_t>;
+#else
+            static_assert(std::numeric_limits<T>::digits <= 31,
+                          "boost::real::real_fixed needs a 128 bits integer for 64 bits digits");
+            using wide_t = long long;
+#endif
+
+            // the number 0.d1 d2 ... dLimbs * BASE^exponent, where d1 != 0 unless the number is zero
+            struct bound {
+                std::array<T, Limbs> digits{};
+                int exponent = 0;
+                bool positive = true;
+
+                bool is_zero() const {
+                    return digits[0] == 0;
+                }
+
+                exact_number<T> as_exact_number() const {
+                    if (is_zero())
+                        return exact_number<T>();
+
+                    return exact_number<T>(std::vector<T>(digits.begin(), digits.end()), exponent, positive);
+                }
+            };
+
+            bound _lower;
+            bound _upper;
+            bool _bounded = false;
+
+            real_fixed(const bound& lower, const bound& upper) : _lower(lower), _upper(upper), _bounded(true) {}
+
+            /// x with the given sign, zero is always positive
+            static bound with_sign(bound x, bool positive) {
+                x.positive = positive || x.is_zero();
+                return x;
+            }
+
+            /// adds a unit of the last digit of |x|
+            static void increment(bound& x) {
+                for (size_t i = Limbs; i-- > 0;) {
+                    if (x.digits[i] < BASE - 1) {
+                        x.digits[i]++;
+                        return;
+                    }
+                    x.digits[i] = 0;
+                }
+
+                x.digits[0] = 1;
+                x.exponent++;
+            }
+
+            /**
+             * @brief Rounds 0.w1 w2 ... wN * BASE^exponent, plus something lower than a unit of wN if
+             * sticky, to Limbs digits: away from zero if up, towards zero otherwise.
+             */
+            template <size_t N>
+            static bound rounded(const std::array<T, N>& work, int exponent, bool sticky, bool up) {
+                bound result;
+                size_t first = 0;
+                while (first < N && work[first] == 0)
+                    first++;
+
+                if (first == N) {
+                    if (sticky && up) {
+                        result.digits[0] = 1;
+                        result.exponent = exponent - (int) N + 1;
+                    }
+                    return result;
+                }
+
+                for (size_t i = 0; i < Limbs && first + i < N; i++)
+                    result.digits[i] = work[first + i];
+                result.exponent = exponent - (int) first;
+
+                bool inexact = sticky || std::any_of(work.begin() + std::min(N, first + Limbs), work.end(),
+                                                     [] (T digit) { return digit != 0; });
+                if (up && inexact)
+                    increment(result);
+
+                return result;
+            }
+
+            /// -1, 0 or 1 if |x| is lower, equal or greater than |y|
+            static int compare_magnitudes(const bound& x, const bound& y) {
+                if (x.is_zero() || y.is_zero())
+                    return (int) !x.is_zero() - (int) !y.is_zero();
+
+                if (x.exponent != y.exponent)
+                    return x.exponent < y.exponent ? -1 : 1;
+
+                for (size_t i = 0; i < Limbs; i++)
+                    if (x.digits[i] != y.digits[i])
+                        return x.digits[i] < y.digits[i] ? -1 : 1;
+
+                return 0;
+            }
+
+            /// -1, 0 or 1 if x is lower, equal or greater than y
+            static int order(const bound& x, const bound& y) {
+                int x_sign = x.is_zero() ? 0 : (x.positive ? 1 : -1);
+                int y_sign = y.is_zero() ? 0 : (y.positive ? 1 : -1);
+
+                if (x_sign != y_sign)
+                    return x_sign < y_sign ? -1 : 1;
+
+                return x_sign * compare_magnitudes(x, y);
+            }
+
+            /// |x| + |y|, or |x| - |y| if subtract (then |x| >= |y|), rounded as in rounded()
+            static bound add_magnitudes(const bound& x, const bound& y, bool subtract, bool up) {
+                if (y.is_zero())
+                    return with_sign(x, true);
+                if (x.is_zero())
+                    return with_sign(y, true);
+
+                const bound& larger = (y.exponent > x.exponent) ? y : x;
+                const bound& smaller = (y.exponent > x.exponent) ? x : y;
+                size_t shift = larger.exponent - smaller.exponent;
+
+                // the first digit of work is left for the carry
+                constexpr size_t N = 2 * Limbs + 3;
+                std::array<T, N> work{};
+                std::array<T, N> other{};
+
+                for (size_t i = 0; i < Limbs; i++)
+                    work[1 + i] = larger.digits[i];
+
+                if (shift <= Limbs + 1) {
+                    for (size_t i = 0; i < Limbs; i++)
+                        other[1 + shift + i] = smaller.digits[i];
+                } else {
+                    // smaller is below the last digit of larger and the one after it, any lower positive
+                    // number rounds to the same results
+                    other[Limbs + 2] = 1;
+                }
+
+                T carry = 0;
+                for (size_t i = N; i-- > 0;) {
+                    T digit = subtract ? work[i] - other[i] - carry : work[i] + other[i] + carry;
+                    carry = subtract ? (T) (digit < 0) : (T) (digit >= BASE);
+                    work[i] = subtract ? (digit < 0 ? digit + BASE : digit) : (digit >= BASE ? digit - BASE : digit);
+                }
+
+                return rounded(work, larger.exponent + 1, false, up);
+            }
+
+            /// |x| * |y|, rounded as in rounded()
+            static bound multiply_magnitudes(const bound& x, const bound& y, bool up) {
+                if (x.is_zero() || y.is_zero())
+                    return bound();
+
+                std::array<T, 2 * Limbs> work{};
+                for (size_t i = Limbs; i-- > 0;) {
+                    wide_t carry = 0;
+                    for (size_t j = Limbs; j-- > 0;) {
+                        wide_t digit = (wide_t) x.digits[i] * y.digits[j] + work[i + j + 1] + carry;
+                        work[i + j + 1] = (T) (digit % BASE);
+                        carry = digit / BASE;
+                    }
+                    work[i] = (T) carry;
+                }
+
+                return rounded(work, x.exponent + y.exponent, false, up);
+            }
+
+            /**
+             * @brief |x| / |y|, rounded as in rounded(), for y != 0. It is the long division of the
+             * digits of x, followed by Limbs + 1 zeros, by the digits of y: both are first multiplied by a
+             * factor that makes the leading digit of y at least BASE / 2, so each quotient digit estimated
+             * from the two leading digits of the remainder is at most 2 units too high (Knuth's algorithm D).
+             */
+            static bound divide_magnitudes(const bound& x, const bound& y, bool up) {
+                if (x.is_zero())
+                    return bound();
+
+                T factor = BASE / (y.digits[0] + 1);
+                std::array<T, Limbs> divisor{};
+                std::array<T, 2 * Limbs + 2> remainder{};
+
+                wide_t divisor_carry = 0;
+                wide_t remainder_carry = 0;
+                for (size_t i = Limbs; i-- > 0;) {
+                    wide_t digit = (wide_t) y.digits[i] * factor + divisor_carry;
+                    divisor[i] = (T) (digit % BASE);
+                    divisor_carry = digit / BASE;
+
+                    digit = (wide_t) x.digits[i] * factor + remainder_carry;
+                    remainder[i + 1] = (T) (digit % BASE);
+                    remainder_carry = digit / BASE;
+                }
+                remainder[0] = (T) remainder_carry;
+
+                std::array<T, Limbs + 2> quotient{};
+                for (size_t j = 0; j < Limbs + 2; j++) {
+                    wide_t estimate = ((wide_t) remainder[j] * BASE + remainder[j + 1]) / divisor[0];
+                    estimate = std::min(estimate, (wide_t) BASE - 1);
+
+                    // remainder[j..j + Limbs] -= estimate * divisor
+                    wide_t carry = 0;
+                    wide_t borrow = 0;
+                    for (size_t i = Limbs; i-- > 0;) {
+                        wide_t product = estimate * divisor[i] + carry;
+                        carry = product / BASE;
+
+                        wide_t digit = (wide_t) remainder[j + 1 + i] - product % BASE - borrow;
+                        borrow = digit < 0;
+                        remainder[j + 1 + i] = (T) (digit < 0 ? digit + BASE : digit);
+                    }
+                    wide_t top = (wide_t) remainder[j] - carry - borrow;
+
+                    // the estimate was too high, the divisor is added back
+                    while (top < 0) {
+                        estimate--;
+                        T add_carry = 0;
+                        for (size_t i = Limbs; i-- > 0;) {
+                            T digit = remainder[j + 1 + i] + divisor[i] + add_carry;
+                            add_carry = (T) (digit >= BASE);
+                            remainder[j + 1 + i] = digit >= BASE ? digit - BASE : digit;
+                        }
+                        top += add_carry;
+                    }
+
+                    remainder[j] = (T) top;
+                    quotient[j] = (T) estimate;
+                }
+
+                bool sticky = std::any_of(remainder.begin(), remainder.end(), [] (T digit) { return digit != 0; });
+                return rounded(quotient, x.exponent - y.exponent + 1, sticky, up);
+            }
+
+            /// x + y, rounded towards +infinity if up, towards -infinity otherwise
+            static bound add(const bound& x, const bound& y, bool up) {
+                if (x.positive == y.positive)
+                    return with_sign(add_magnitudes(x, y, false, up == x.positive), x.positive);
+
+                int order = compare_magnitudes(x, y);
+                if (order == 0)
+                    return bound();
+
+                const bound& larger = (order > 0) ? x : y;
+                const bound& smaller = (order > 0) ? y : x;
+                return with_sign(add_magnitudes(larger, smaller, true, up == larger.positive), larger.positive);
+            }
+
+            static bound negated(const bound& x) {
+                return with_sign(x, !x.positive);
+            }
+
+            /// x * y, rounded towards +infinity if up, towards -infinity otherwise
+            static bound multiply(const bound& x, const bound& y, bool up) {
+                bool positive = x.positive == y.positive;
+                return with_sign(multiply_magnitudes(x, y, up == positive), positive);
+            }
+
+            /// x / y, rounded towards +infinity if up, towards -infinity otherwise
+            static bound divide(const bound& x, const bound& y, bool up) {
+                bool positive = x.positive == y.positive;
+                return with_sign(divide_magnitudes(x, y, up == positive), positive);
+            }
+
+            /// the interval between the lowest of the lower results and the highest of the upper ones
+            static real_fixed extremes(const bound (&lower)[4], const bound (&upper)[4]) {
+                auto less = [] (const bound& x, const bound& y) { return order(x, y) < 0; };
+                return real_fixed(*std::min_element(std::begin(lower), std::end(lower), less),
+                                  *std::max_element(std::begin(upper), std::end(upper), less));
+            }
+
+            /// the interval that encloses 0.d1 d2 d3 ... * BASE^exponent, given the digits in [first, last)
+            template <typename Iterator>
+            static real_fixed enclosing(Iterator first, Iterator last, int exponent, bool positive, bool more_digits) {
+                while (first != last && *first == 0) {
+                    ++first;
+                    --exponent;
+                }
+
+                std::array<T, Limbs> digits{};
+                size_t size = 0;
+                for (; first != last && size < Limbs; ++first)
+                    digits[size++] = *first;
+
+                bound truncated = rounded(digits, exponent, false, false);
+                bound away;
+
+                if (size < Limbs && more_digits) {
+                    // the rest of the digits add up to less than a unit of the last given one
+                    bound unit;
+                    unit.digits[0] = 1;
+                    unit.exponent = exponent - (int) size + 1;
+                    away = add_magnitudes(truncated, unit, false, true);
+                } else {
+                    more_digits = more_digits || std::any_of(first, last, [] (T digit) { return digit != 0; });
+                    away = rounded(digits, exponent, more_digits, true);
+                }
+
+                if (positive)
+                    return real_fixed(truncated, away);
+
+                return real_fixed(negated(away), negated(truncated));
+            }
+
+        public:
+            /// number of digits of each boundary
+            static constexpr size_t LIMBS = Limbs;
+
+            /// @brief *default constructor*: It constructs the whole real line, which is not bounded.
+            real_fixed() = default;
+
+            /**
+             * @brief Constructs the smallest boost::real::real_fixed interval that encloses x.
+             */
+            explicit real_fixed(const exact_number<T>& x) {
+                *this = enclosing(x.digits.begin(), x.digits.end(), x.exponent, x.positive, false);
+            }
+
+            /**
+             * @brief Constructs the smallest boost::real::real_fixed interval that encloses the interval x.
+             */
+            explicit real_fixed(const interval<T>& x) {
+                real_fixed lower(x.lower_bound);
+                real_fixed upper(x.upper_bound);
+                *this = real_fixed(lower._lower, upper._upper);
+            }
+
+            /**
+             * @brief The interval that encloses the number 0.d1 d2 d3 ... * base^exponent, given its leading
+             * digits. If the digits are truncated (more_digits), the rest of them add up to less than a
+             * unit of the last leading digit. base must be the internal base, in which the boundaries
+             * are kept.
+             */
+            static real_fixed from_digits(const std::vector<T>& leading_digits, int exponent, bool positive,
+                                          bool more_digits, T base) {
+                if (base != BASE)
+                    throw invalid_representation_exception();
+
+                return enclosing(leading_digits.begin(), leading_digits.end(), exponent, positive, more_digits);
+            }
+
+            /// @return false if the interval is the whole real line
+            bool bounded() const {
+                return _bounded;
+            }
+
+            /// @throws boost::real::precision_exception if the interval is not bounded
+            exact_number<T> lower() const {
+                if (!_bounded)
+                    throw precision_exception();
+
+                return _lower.as_exact_number();
+            }
+
+            /// @throws boost::real::precision_exception if the interval is not bounded
+            exact_number<T> upper() const {
+                if (!_bounded)
+                    throw precision_exception();
+
+                return _upper.as_exact_number();
+            }
+
+            bool contains_zero() const {
+                return !_bounded || (order(_lower, bound()) <= 0 && order(bound(), _upper) <= 0);
+            }
+
+            /// true if every number in *this is lower than every number in other
+            bool operator<(const real_fixed& other) const {
+                return _bounded && other._bounded && order(_upper, other._lower) < 0;
+            }
+
+            /// true if every number in *this is greater than every number in other
+            bool operator>(const real_fixed& other) const {
+                return other < *this;
+            }
+
+            /**
+             * @brief Three-way comparison between the numbers enclosed by *this and other.
+             *
+             * @return ORDERING::LESS or ORDERING::GREATER if the intervals do not overlap,
+             * ORDERING::EQUAL if both are the same single number, ORDERING::UNDECIDED otherwise.
+             */
+            ORDERING compare(const real_fixed& other) const {
+                if (*this < other)
+                    return ORDERING::LESS;
+
+                if (other < *this)
+                    return ORDERING::GREATER;
+
+                if (_bounded && other._bounded && order(_lower, _upper) == 0 &&
+                    order(other._lower, other._upper) == 0 && order(_lower, other._lower) == 0)
+                    return ORDERING::EQUAL;
+
+                return ORDERING::UNDECIDED;
+            }
+
+            real_fixed operator-() const {
+                if (!_bounded)
+                    return real_fixed();
+
+                return real_fixed(negated(_upper), negated(_lower));
+            }
+
+            real_fixed abs() const {
+                if (!_bounded || order(bound(), _lower) <= 0)
+                    return *this;
+
+                if (order(_upper, bound()) <= 0)
+                    return -*this;
+
+                return real_fixed(bound(), compare_magnitudes(_lower, _upper) > 0 ? negated(_lower) : _upper);
+            }
+
+            real_fixed operator+(const real_fixed& other) const {
+                if (!_bounded || !other._bounded)
+                    return real_fixed();
+
+                return real_fixed(add(_lower, other._lower, false), add(_upper, other._upper, true));
+            }
+
+            real_fixed operator-(const real_fixed& other) const {
+                if (!_bounded || !other._bounded)
+                    return real_fixed();
+
+                return real_fixed(add(_lower, negated(other._upper), false), add(_upper, negated(other._lower), true));
+            }
+
+            real_fixed operator*(const real_fixed& other) const {
+                if (!_bounded || !other._bounded)
+                    return real_fixed();
+
+                bound lower[] = {multiply(_lower, other._lower, false), multiply(_lower, other._upper, false),
+                                 multiply(_upper, other._lower, false), multiply(_upper, other._upper, false)};
+                bound upper[] = {multiply(_lower, other._lower, true), multiply(_lower, other._upper, true),
+                                 multiply(_upper, other._lower, true), multiply(_upper, other._upper, true)};
+                return extremes(lower, upper);
+            }
+
+            /// the whole real line if other contains zero
+            real_fixed operator/(const real_fixed& other) const {
+                if (!_bounded || other.contains_zero())
+                    return real_fixed();
+
+                bound lower[] = {divide(_lower, other._lower, false), divide(_lower, other._upper, false),
+                                 divide(_upper, other._lower, false), divide(_upper, other._upper, false)};
+                bound upper[] = {divide(_lower, other._lower, true), divide(_lower, other._upper, true),
+                                 divide(_upper, other._lower, true), divide(_upper, other._upper, true)};
+                return extremes(lower, upper);
+            }
+
+            real_fixed& operator+=(const real_fixed& other) {
+                return *this = *this + other;
+            }
+
+            real_fixed& operator-=(const real_fixed& other) {
+                return *this = *this - other;
+            }
+
+            real_fixed& operator*=(const real_fixed& other) {
+                return *this = *this * other;
+            }
+
+            real_fixed& operator/=(const real_fixed& other) {
+                return *this = *this / other;
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_FIXED_HPP
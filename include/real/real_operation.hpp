@@ -2,7 +2,12 @@
 #define BOOST_REAL_REAL_OPERATION
 
 #include <memory> // shared_ptr
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
 
+#include <real/interval.hpp>
 #include <real/real_algorithm.hpp>
 #include <real/real_explicit.hpp>
 
@@ -16,12 +21,23 @@ namespace boost{
         class const_precision_iterator;
 
         /*
-        * @brief real_operation is a (very unbalanced) binary tree representation of operations, where
-        * the leaves are the operands and the nodes store the type of operation
+        * @brief real_operation is a binary tree representation of operations, where the leaves are the
+        * operands and the nodes store the type of operation. Runs of additions or multiplications are
+        * kept balanced as they are built (see real::make_operation)
         * 
-        * @warning due to the recursive nature of real_operation, destruction may cause stack overflow
+        * @note real_data destroys the operands iteratively (see real_data::~real_data), so long chains
+        * of operations do not overflow the stack when they are released
+        *
+        * SUM and PRODUCT are n-ary: they hold any number of operands in a contiguous vector instead of a
+        * left and a right operand (see operand_count() and operand()). So is DOT, the sum of the products
+        * of its pairs of operands a0 * b0 + a1 * b1 + ..., stored interleaved as a0, b0, a1, b1, ...
+        *
+        * POWER is unary: its only operand is the left one, raised to an integer exponent held by the node
+        * (see exponent()). So are NEGATE, ABS and SCALE, the operand times base^exponent, which transform
+        * the interval of the operand without calculating any digit.
         */
-        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION}; 
+        enum class OPERATION{ADDITION, SUBTRACTION, MULTIPLICATION, DIVISION, SUM, PRODUCT, POWER, DOT, NEGATE,
+                             ABS, SCALE}; 
 
         template <typename T = int>
         class real_operation{
@@ -30,6 +46,25 @@ namespace boost{
             std::shared_ptr<real_data<T>> _rhs;
             OPERATION _operation;
 
+            // the operands of SUM, PRODUCT and DOT, _lhs and _rhs are null for them
+            std::vector<std::shared_ptr<real_data<T>>> _operands;
+
+            // the exponent of POWER and SCALE, _rhs is null for the unary operations
+            long _exponent = 0;
+
+            // number of operands of the balanced run of additions or multiplications the node is the root
+            // of, 0 if the node is not the root of a balanced run (see real::make_operation)
+            size_t _balanced_operands = 0;
+
+            // Best approximation interval computed so far for each precision. Operands are shared between
+            // several parents and every comparison walks the precisions from cbegin(), so the same interval
+            // is requested many times. The division result depends on the maximum precision, so the cache
+            // is only valid for the maximum precision it was filled with. Copies of the operation node,
+            // which are not guarded by the lock of its real_data, fill it too, so it has its own lock.
+            std::vector<std::optional<interval<T>>> _intervals;
+            size_t _intervals_maximum_precision = 0;
+            mutable std::shared_mutex _intervals_mutex;
+
         public:
 
             /*
@@ -40,6 +75,60 @@ namespace boost{
              */
             real_operation(std::shared_ptr<real_data<T>> &lhs, std::shared_ptr<real_data<T>> &rhs, OPERATION op) : _lhs(lhs), _rhs(rhs), _operation(op) {};
 
+            /*
+             * @brief Constructor for the nodes of balanced runs of additions or multiplications
+             * @param balanced_operands - number of operands of the balanced run the node is the root of
+             */
+            real_operation(std::shared_ptr<real_data<T>> &lhs, std::shared_ptr<real_data<T>> &rhs, OPERATION op,
+                           size_t balanced_operands) : _lhs(lhs), _rhs(rhs), _operation(op),
+                                                       _balanced_operands(balanced_operands) {};
+
+            /*
+             * @brief Constructor of the n-ary operations
+             * @param operands - the operands, at least two, in pairs for OPERATION::DOT
+             * @param op - OPERATION::SUM, OPERATION::PRODUCT or OPERATION::DOT
+             */
+            real_operation(std::vector<std::shared_ptr<real_data<T>>> operands, OPERATION op) :
+                    _operation(op), _operands(std::move(operands)) {};
+
+            /*
+             * @brief Constructor of the unary operations
+             * @param operand - the operand
+             * @param op - OPERATION::POWER, OPERATION::NEGATE, OPERATION::ABS or OPERATION::SCALE
+             * @param exponent - the integer exponent the operand is raised to, or the power of the base
+             * it is scaled by, 0 for NEGATE and ABS
+             */
+            real_operation(std::shared_ptr<real_data<T>> operand, OPERATION op, long exponent = 0) :
+                    _lhs(std::move(operand)), _operation(op), _exponent(exponent) {};
+
+            /// copy ctor - copies the operands, the operation and the cached intervals
+            real_operation(const real_operation<T> &other) : _lhs(other._lhs), _rhs(other._rhs), _operation(other._operation),
+                                                             _operands(other._operands), _exponent(other._exponent),
+                                                             _balanced_operands(other._balanced_operands) {
+                std::shared_lock<std::shared_mutex> lock(other._intervals_mutex);
+                _intervals = other._intervals;
+                _intervals_maximum_precision = other._intervals_maximum_precision;
+            }
+
+            real_operation<T>& operator=(const real_operation<T> &other) {
+                if (this == &other)
+                    return *this;
+
+                _lhs = other._lhs;
+                _rhs = other._rhs;
+                _operation = other._operation;
+                _operands = other._operands;
+                _exponent = other._exponent;
+                _balanced_operands = other._balanced_operands;
+
+                std::unique_lock<std::shared_mutex> lock(_intervals_mutex, std::defer_lock);
+                std::shared_lock<std::shared_mutex> other_lock(other._intervals_mutex, std::defer_lock);
+                std::lock(lock, other_lock);
+                _intervals = other._intervals;
+                _intervals_maximum_precision = other._intervals_maximum_precision;
+                return *this;
+            }
+
             OPERATION get_operation() const {
                 return _operation;
             }
@@ -50,6 +139,56 @@ namespace boost{
             /// fwd decl'd, defined in real_data
             const_precision_iterator<T>& get_rhs_itr();
 
+            /// true for the operations with any number of operands, SUM, PRODUCT and DOT
+            bool is_nary() const {
+                return _operation == OPERATION::SUM || _operation == OPERATION::PRODUCT ||
+                       _operation == OPERATION::DOT;
+            }
+
+            /// true for the operations with a single operand, POWER, NEGATE, ABS and SCALE
+            bool is_unary() const {
+                return _operation == OPERATION::POWER || _operation == OPERATION::NEGATE ||
+                       _operation == OPERATION::ABS || _operation == OPERATION::SCALE;
+            }
+
+            /// number of operands, 2 for the binary operations
+            size_t operand_count() const {
+                if (is_nary())
+                    return _operands.size();
+
+                return is_unary() ? 1 : 2;
+            }
+
+            /// the exponent of a POWER, or the power of the base a SCALE multiplies by
+            long exponent() const {
+                return _exponent;
+            }
+
+            /// the i-th operand, the unary operations have lhs() as only operand, the binary ones lhs() as
+            /// first operand and rhs() as second one
+            const std::shared_ptr<real_data<T>>& operand(size_t i) const {
+                if (is_nary())
+                    return _operands[i];
+
+                return i == 0 ? _lhs : _rhs;
+            }
+
+            /// fwd decl'd, defined in real_data
+            const_precision_iterator<T>& get_operand_itr(size_t i);
+
+            /**
+             * @brief Appends an operand to a SUM or PRODUCT. The node owning the operation must calculate
+             * its intervals again, the cached ones are dropped.
+             */
+            void append(std::shared_ptr<real_data<T>> operand) {
+                _operands.push_back(std::move(operand));
+                clear_intervals();
+            }
+
+            size_t balanced_operands() const {
+                return _balanced_operands;
+            }
+
             std::shared_ptr<real_data<T>> rhs() const {
                 return _rhs;
             }
@@ -57,6 +196,66 @@ namespace boost{
             std::shared_ptr<real_data<T>> lhs() const {
                 return _lhs;
             }
+
+            /**
+             * @brief Moves the operands out of the operation into released. Used by real_data to
+             * release operation trees without recursion, the operation is left without operands.
+             */
+            void release_operands(std::vector<std::shared_ptr<real_data<T>>>& released) {
+                if (_lhs)
+                    released.push_back(std::move(_lhs));
+
+                if (_rhs)
+                    released.push_back(std::move(_rhs));
+
+                for (std::shared_ptr<real_data<T>>& operand : _operands)
+                    if (operand)
+                        released.push_back(std::move(operand));
+                _operands.clear();
+            }
+
+            /**
+             * @brief Looks for an already calculated approximation interval of the operation.
+             *
+             * @param precision - the precision of the requested interval.
+             * @param maximum_precision - the maximum precision in use by the requesting iterator.
+             * @param approximation - receives a copy of the cached interval, if any.
+             * @return true if the interval was already calculated.
+             */
+            bool cached_interval(size_t precision, size_t maximum_precision, interval<T>& approximation) const {
+                std::shared_lock<std::shared_mutex> lock(_intervals_mutex);
+                if (maximum_precision != _intervals_maximum_precision || precision >= _intervals.size() ||
+                    !_intervals[precision])
+                    return false;
+
+                approximation = *_intervals[precision];
+                return true;
+            }
+
+            /**
+             * @brief Stores the approximation interval calculated for the given precision. A different
+             * maximum precision than the one of the stored intervals invalidates all of them.
+             */
+            void cache_interval(size_t precision, size_t maximum_precision, const interval<T>& approximation) {
+                std::unique_lock<std::shared_mutex> lock(_intervals_mutex);
+                if (maximum_precision != _intervals_maximum_precision) {
+                    _intervals.clear();
+                    _intervals.reserve(maximum_precision + 1);
+                    _intervals_maximum_precision = maximum_precision;
+                }
+
+                if (precision >= _intervals.size())
+                    _intervals.resize(precision + 1);
+
+                _intervals[precision] = approximation;
+            }
+
+            /// drops the cached intervals, after a placeholder below the operation was bound to a new number
+            void clear_intervals() {
+                std::unique_lock<std::shared_mutex> lock(_intervals_mutex);
+                _intervals.clear();
+                _intervals_maximum_precision = 0;
+            }
         };
     }
 }
@@ -0,0 +1,61 @@
+#ifndef BOOST_REAL_REAL_PLACEHOLDER_HPP
+#define BOOST_REAL_REAL_PLACEHOLDER_HPP
+
+#include <memory> // shared_ptr
+#include <utility>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        // fwd decl needed
+        template <typename T>
+        class real_data;
+        template <typename T>
+        class const_precision_iterator;
+
+        /**
+         * @brief boost::real::real_placeholder is a leaf that stands for the number bound to it. The
+         * same operation tree can be evaluated for a stream of inputs by binding its placeholders to
+         * new numbers (see real::bind), instead of building the tree again for each of them.
+         *
+         * @details The approximation intervals of a placeholder are the ones of the bound number, which
+         * is refined through its own shared iterator as the placeholder is refined.
+         */
+        template <typename T = int>
+        class real_placeholder {
+        private:
+            std::shared_ptr<real_data<T>> _value;
+
+        public:
+            /**
+             * @brief Constructor from the first bound number
+             * @param value - the number the placeholder stands for
+             */
+            explicit real_placeholder(std::shared_ptr<real_data<T>> value) : _value(std::move(value)) {}
+
+            std::shared_ptr<real_data<T>> value() const {
+                return _value;
+            }
+
+            /// fwd decl'd, defined in real_data
+            const_precision_iterator<T>& get_value_itr();
+
+            /// replaces the bound number, the nodes that depend on the placeholder must be invalidated
+            void bind(std::shared_ptr<real_data<T>> value) {
+                _value = std::move(value);
+            }
+
+            /**
+             * @brief Moves the bound number out of the placeholder into released. Used by real_data to
+             * release operation trees without recursion.
+             */
+            void release_operands(std::vector<std::shared_ptr<real_data<T>>>& released) {
+                if (_value)
+                    released.push_back(std::move(_value));
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_PLACEHOLDER_HPP
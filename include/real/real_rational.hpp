@@ -0,0 +1,377 @@
+#ifndef BOOST_REAL_REAL_RATIONAL_HPP
+#define BOOST_REAL_REAL_RATIONAL_HPP
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <real/comparison.hpp>
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+#include <real/real_exception.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief boost::real::real_rational is a C++ class that represents rational numbers exactly, as
+         * the quotient of an integer numerator and a positive integer denominator. It is the leaf built
+         * for decimal literals that are not integers, as "1.5" = 15 / 10.
+         *
+         * @details The digits of the number are produced by a single long division, which is carried
+         * on as more digits are needed: each digit costs one short step of the division, and the digits
+         * already calculated and the remainder are cached, shared by the copies of the number. Sums,
+         * differences and products of rational numbers are rational numbers, calculated exactly.
+         */
+        template <typename T = int>
+        class real_rational {
+            using exponent_t = typename exact_number<T>::exponent_t;
+
+            // the long division of |numerator| by denominator, guarded by mutex
+            struct expansion {
+                std::mutex mutex;
+                // digits of the quotient from the first non zero one, as in boost::real::real_algorithm
+                std::vector<T> digits;
+                // what is left to divide, scaled so the next digit is remainder / denominator
+                exact_number<T> remainder;
+                // the remainder became zero, the digits are the whole quotient
+                bool finished = false;
+            };
+
+            // the numerator holds the sign, the denominator is positive and not zero
+            exact_number<T> _numerator;
+            exact_number<T> _denominator;
+            exponent_t _exponent = 0;
+            std::shared_ptr<expansion> _expansion;
+
+            static T base() {
+                return (std::numeric_limits<T>::max() / 4) * 2;
+            }
+
+            static bool is_zero(const exact_number<T>& x) {
+                return std::all_of(x.digits.begin(), x.digits.end(), [] (T digit) { return digit == 0; });
+            }
+
+            static void normalize(exact_number<T>& x) {
+                x.normalize();
+                if (x.digits.empty() || is_zero(x))
+                    x = exact_number<T>(std::vector<T>{0}, 0);
+            }
+
+            // replaces the integer x by x / divisor if divisor divides it. divisor must be small, so
+            // remainder * base does not overflow once split as below.
+            static bool divide_exactly(exact_number<T>& x, T divisor) {
+                if (is_zero(x))
+                    return true;
+
+                T quotient_base = base() / divisor;
+                T remainder_base = base() % divisor;
+
+                // the integer digits, the ones after the stored digits are zeros
+                std::vector<T> digits = x.digits;
+                digits.resize(std::max<size_t>(digits.size(), x.exponent), 0);
+
+                std::vector<T> quotient(digits.size());
+                T remainder = 0;
+                for (size_t i = 0; i < digits.size(); i++) {
+                    // (remainder * base + digit) / divisor, with remainder < divisor
+                    T low = remainder * remainder_base + digits[i];
+                    quotient[i] = remainder * quotient_base + low / divisor;
+                    remainder = low % divisor;
+                }
+
+                if (remainder != 0)
+                    return false;
+
+                x = exact_number<T>(quotient, (exponent_t)quotient.size(), x.positive);
+                normalize(x);
+                return true;
+            }
+
+            // removes the common powers of the base of the numerator and the denominator, then their common
+            // factors 2 and 5. The denominators of decimal literals, and of their sums and products, are
+            // products of powers of 2 and 5, so their fractions are left in lowest terms. Scalings multiply
+            // them by powers of the base, which are removed again, so scaled integers are recognized as such.
+            void reduce() {
+                // an integer ends in as many zero digits as the powers of the base that divide it
+                if (!is_zero(_numerator)) {
+                    exponent_t common = std::min(_numerator.exponent - (exponent_t)_numerator.digits.size(),
+                                                 _denominator.exponent - (exponent_t)_denominator.digits.size());
+                    if (common > 0) {
+                        _numerator.exponent -= common;
+                        _denominator.exponent -= common;
+                    }
+                }
+
+                for (T factor : {(T)10, (T)2, (T)5}) {
+                    while (true) {
+                        exact_number<T> numerator = _numerator;
+                        exact_number<T> denominator = _denominator;
+                        if (!divide_exactly(denominator, factor) || !divide_exactly(numerator, factor))
+                            break;
+
+                        _numerator = std::move(numerator);
+                        _denominator = std::move(denominator);
+                    }
+                }
+            }
+
+            // leading digits of |x| as a fraction of its first digit
+            static long double mantissa(const exact_number<T>& x) {
+                long double result = 0;
+                long double scale = 1;
+                for (size_t i = 0; i < std::min<size_t>(x.digits.size(), 3); i++) {
+                    result += x.digits[i] * scale;
+                    scale /= base();
+                }
+                return result;
+            }
+
+            // the next digit of the division, expansion must be locked
+            void next_digit(expansion& e) const {
+                exact_number<T>& remainder = e.remainder;
+
+                // estimation of remainder / denominator, corrected to the exact digit
+                T digit = 0;
+                if (!is_zero(remainder)) {
+                    long double estimation = mantissa(remainder) / mantissa(_denominator);
+                    for (exponent_t i = _denominator.exponent; i < remainder.exponent; i++)
+                        estimation *= base();
+                    for (exponent_t i = remainder.exponent; i < _denominator.exponent; i++)
+                        estimation /= base();
+
+                    estimation = std::min<long double>(std::max<long double>(estimation, 0), base() - 1);
+                    digit = (T) estimation;
+                }
+
+                exact_number<T> product = _denominator * exact_number<T>(std::vector<T>{digit}, 1);
+                normalize(product);
+                while (digit > 0 && remainder < product) {
+                    --digit;
+                    product = product - _denominator;
+                    normalize(product);
+                }
+
+                exact_number<T> next = product + _denominator;
+                normalize(next);
+                while (digit < base() - 1 && !(remainder < next)) {
+                    ++digit;
+                    product = next;
+                    next = next + _denominator;
+                    normalize(next);
+                }
+
+                remainder = remainder - product;
+                normalize(remainder);
+                e.digits.push_back(digit);
+
+                if (is_zero(remainder))
+                    e.finished = true;
+                else
+                    remainder.exponent++; // remainder * base
+            }
+
+            // calculates the digits up to the n-th one, or the whole quotient if it is shorter
+            const std::vector<T>& digits_up_to(size_t n) const {
+                expansion& e = *_expansion;
+                while (!e.finished && e.digits.size() <= n)
+                    next_digit(e);
+                return e.digits;
+            }
+
+            void start_expansion() {
+                normalize(_numerator);
+                normalize(_denominator);
+                _expansion = std::make_shared<expansion>();
+
+                exact_number<T> numerator = _numerator.abs();
+                if (is_zero(numerator)) {
+                    _exponent = 0;
+                    _expansion->digits = {0};
+                    _expansion->finished = true;
+                    return;
+                }
+
+                // numerator / denominator is in [base^(exponent - 1), base^exponent)
+                _exponent = numerator.exponent - _denominator.exponent;
+                exact_number<T> shifted = _denominator;
+                shifted.exponent += _exponent;
+                if (!(numerator < shifted))
+                    _exponent++;
+
+                numerator.exponent -= _exponent - 1;
+                _expansion->remainder = numerator;
+            }
+
+        public:
+            /**
+             * @brief *Default constructor:* Construct an empty boost::real::real_rational with
+             * undefined representation and behaviour.
+             */
+            real_rational() = default;
+
+            /**
+             * @brief *Copy constructor:* Creates a copy of the boost::real::real_rational number other,
+             * which shares the digits calculated for other.
+             *
+             * @param other - the boost::real::real_rational instance to copy.
+             */
+            real_rational(const real_rational& other) = default;
+
+            /**
+             * @brief *Fraction constructor:* Creates the boost::real::real_rational numerator / denominator.
+             *
+             * @param numerator - an integer in the internal base, with the sign of the number.
+             * @param denominator - a positive integer in the internal base.
+             * @param reduce - if true, the common powers of the base and the common factors 2 and 5 of
+             * numerator and denominator are removed.
+             *
+             * @throws boost::real::divide_by_zero if denominator is zero.
+             */
+            real_rational(exact_number<T> numerator, exact_number<T> denominator, bool reduce = true)
+                    : _numerator(std::move(numerator)), _denominator(std::move(denominator)) {
+                normalize(_denominator);
+                if (is_zero(_denominator))
+                    throw boost::real::divide_by_zero();
+
+                if (!_denominator.positive) {
+                    _denominator.positive = true;
+                    _numerator.positive = !_numerator.positive;
+                }
+
+                normalize(_numerator);
+                if (reduce)
+                    this->reduce();
+
+                start_expansion();
+            }
+
+            const exact_number<T>& numerator() const {
+                return _numerator;
+            }
+
+            const exact_number<T>& denominator() const {
+                return _denominator;
+            }
+
+            /// true if the denominator is one
+            bool is_integer() const {
+                return _denominator == exact_number<T>(std::vector<T>{1}, 1);
+            }
+
+            /**
+             * @return An integer with the number exponent
+             */
+            exponent_t exponent() const {
+                return _exponent;
+            }
+
+            /**
+             * @return A bool indicating if the number is positive (true) or negative (false)
+             */
+            bool positive() const {
+                return _numerator.positive;
+            }
+
+            /**
+             * @brief Returns the n-th digit the number, calculating the digits that are missing.
+             *
+             * @param n - an unsigned int number indicating the index of the requested digit.
+             * @return an integer with the value of the number n-th digit.
+             */
+            T operator[](unsigned int n) const {
+                std::lock_guard<std::mutex> lock(_expansion->mutex);
+                const std::vector<T>& digits = digits_up_to(n);
+                return n < digits.size() ? digits[n] : 0;
+            }
+
+            /// the first n digits of the number, or all of them if there are less
+            std::vector<T> leading_digits(size_t n) const {
+                std::lock_guard<std::mutex> lock(_expansion->mutex);
+                const std::vector<T>& digits = digits_up_to(n);
+                return std::vector<T>(digits.begin(), digits.begin() + std::min(n, digits.size()));
+            }
+
+            /// true if the number has at most n digits, so it is fully represented by them
+            bool exact_within(size_t n) const {
+                std::lock_guard<std::mutex> lock(_expansion->mutex);
+                const std::vector<T>& digits = digits_up_to(n);
+                return _expansion->finished && digits.size() <= n;
+            }
+
+            /**
+             * @brief The approximation interval of the number with precision digits: the number
+             * truncated to its first precision digits, and that plus a unit of the last one, unless
+             * the digits represent the number fully.
+             */
+            interval<T> bounds(size_t precision) const {
+                std::vector<T> digits = leading_digits(precision);
+                exact_number<T> lower(digits, _exponent);
+                exact_number<T> upper = lower;
+
+                if (!exact_within(precision))
+                    upper = lower + exact_number<T>(std::vector<T>{1}, _exponent - (exponent_t)precision + 1);
+
+                lower.normalize_left();
+                upper.normalize_left();
+
+                interval<T> result;
+                if (positive()) {
+                    result.lower_bound = lower;
+                    result.upper_bound = upper;
+                } else {
+                    upper.positive = false;
+                    lower.positive = false;
+                    result.lower_bound = upper;
+                    result.upper_bound = lower;
+                }
+                return result;
+            }
+
+            /// exact three-way comparison, by cross multiplication
+            ORDERING compare(const real_rational& other) const {
+                exact_number<T> lhs = _numerator * other._denominator;
+                exact_number<T> rhs = other._numerator * _denominator;
+                normalize(lhs);
+                normalize(rhs);
+
+                if (lhs < rhs)
+                    return ORDERING::LESS;
+                if (rhs < lhs)
+                    return ORDERING::GREATER;
+                return ORDERING::EQUAL;
+            }
+
+            real_rational operator+(const real_rational& other) const {
+                if (_denominator == other._denominator)
+                    return real_rational(_numerator + other._numerator, _denominator);
+
+                return real_rational(_numerator * other._denominator + other._numerator * _denominator,
+                                     _denominator * other._denominator);
+            }
+
+            real_rational operator-(const real_rational& other) const {
+                exact_number<T> negated = other._numerator;
+                negated.positive = !negated.positive;
+                return *this + real_rational(negated, other._denominator, false);
+            }
+
+            real_rational operator*(const real_rational& other) const {
+                return real_rational(_numerator * other._numerator, _denominator * other._denominator);
+            }
+
+            /**
+             * @brief It assigns a new copy of the other boost::real::real_rational number, sharing its digits.
+             *
+             * @param other - the boost::real::real_rational number to copy.
+             * @return a reference of *this with the new represented number.
+             */
+            real_rational& operator=(const real_rational& other) = default;
+        };
+    }
+}
+
+#endif //BOOST_REAL_REAL_RATIONAL_HPP
@@ -0,0 +1,223 @@
+#ifndef BOOST_REAL_REAL_TAPE_HPP
+#define BOOST_REAL_REAL_TAPE_HPP
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <real/const_precision_iterator.hpp>
+#include <real/interval.hpp>
+#include <real/real_data.hpp>
+#include <real/real_exception.hpp>
+#include <real/real_operation.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A compiled boost::real::real number: its operation tree linearized in a contiguous tape
+         * of instructions, operands first, where each instruction refers to its operands by their index
+         * in the tape and keeps its interval in the slot with its own index.
+         *
+         * @details Each refinement step iterates the leaves and then runs the tape once from start to end,
+         * calculating every operation with the same arithmetic the tree evaluation uses, without
+         * following shared pointers nor dispatching on the number variant. Operands shared by several
+         * nodes get a single instruction. The tape is evaluated from the lowest precision on its own
+         * intervals, the tree it was compiled from is not refined. A tape must not be used by several
+         * threads at once.
+         */
+        template <typename T = int>
+        class real_tape {
+            using iterator = const_precision_iterator<T>;
+
+            struct instruction {
+                // a leaf instruction only refers to its iterator in _leaves, with lhs. A SUM, PRODUCT or DOT
+                // refers to the rhs slots listed in _operands from index lhs. The unary instructions only
+                // have the lhs operand, a POWER raises it to exponent and a SCALE multiplies it by base^exponent.
+                bool leaf;
+                OPERATION operation;
+                size_t lhs;
+                size_t rhs;
+                long exponent = 0;
+            };
+
+            // keeps the leaves, which the leaf iterators point to, alive
+            std::shared_ptr<real_data<T>> _root;
+
+            std::vector<instruction> _instructions;
+            std::vector<size_t> _operands;
+            std::vector<interval<T>> _intervals;
+
+            // operand intervals of the n-ary instruction being run
+            std::vector<interval<T>> _nary_operands;
+            std::vector<iterator> _leaves;
+
+            precision_t _precision = 1;
+            precision_t _maximum_precision;
+
+            // calculates the operations of the tape at the current precision, the leaves must already be at it.
+            // Returns false if a divisor interval, or the operand of a negative power, contains zero.
+            bool run() {
+                for (size_t i = 0; i < _instructions.size(); i++) {
+                    const instruction& current = _instructions[i];
+
+                    if (current.leaf) {
+                        _intervals[i] = _leaves[current.lhs].get_interval();
+                        continue;
+                    }
+
+                    if (current.operation == OPERATION::SUM || current.operation == OPERATION::PRODUCT ||
+                        current.operation == OPERATION::DOT) {
+                        _nary_operands.clear();
+                        for (size_t j = current.lhs; j < current.lhs + current.rhs; j++)
+                            _nary_operands.push_back(_intervals[_operands[j]]);
+
+                        _intervals[i] = iterator::nary_boundaries(current.operation, _nary_operands, _precision,
+                                                                  _maximum_precision);
+                        continue;
+                    }
+
+                    const interval<T>& lhs = _intervals[current.lhs];
+
+                    if (current.operation == OPERATION::POWER || current.operation == OPERATION::NEGATE ||
+                        current.operation == OPERATION::ABS || current.operation == OPERATION::SCALE) {
+                        if (current.operation == OPERATION::POWER && current.exponent < 0 &&
+                            !lhs.positive() && !lhs.negative())
+                            return false;
+
+                        _intervals[i] = iterator::unary_boundaries(current.operation, lhs, current.exponent,
+                                                                   _precision, _maximum_precision);
+                        continue;
+                    }
+
+                    const interval<T>& rhs = _intervals[current.rhs];
+
+                    if (current.operation == OPERATION::DIVISION && !rhs.positive() && !rhs.negative())
+                        return false;
+
+                    _intervals[i] = iterator::operation_boundaries(current.operation, lhs, rhs, _precision,
+                                                                   _maximum_precision);
+                }
+
+                return true;
+            }
+
+            // iterates every leaf and runs the tape once per precision, until a divisor interval, or the
+            // operand of a negative power, does not contain zero or the maximum precision is reached
+            void evaluate(int n) {
+                if (n > 0) {
+                    for (iterator& leaf : _leaves)
+                        leaf.iterate_n_times(n);
+                    _precision += n;
+                }
+
+                while (!run()) {
+                    if (_precision > _maximum_precision)
+                        throw boost::real::divergent_division_result_exception();
+
+                    for (iterator& leaf : _leaves)
+                        leaf.iterate_n_times(1);
+                    _precision++;
+                }
+            }
+
+        public:
+            /**
+             * @brief Compiles the tree of root into a tape and evaluates it at the lowest precision.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor still contains zero
+             * at the maximum precision.
+             */
+            explicit real_tape(std::shared_ptr<real_data<T>> root) : _root(std::move(root)) {
+                {
+                    std::shared_lock<std::shared_mutex> lock(_root->get_mutex());
+                    _maximum_precision = _root->get_precision_itr().maximum_precision();
+                }
+
+                std::unordered_map<real_data<T>*, size_t> slot;
+                std::vector<std::pair<real_data<T>*, bool>> pending;
+                pending.push_back({_root.get(), false});
+
+                // post-order walk with an explicit stack, so the operands always come first in the tape
+                while (!pending.empty()) {
+                    auto [node, operands_ready] = pending.back();
+                    auto operation = std::get_if<real_operation<T>>(&node->get_real_number());
+
+                    if (slot.find(node) != slot.end()) { // shared operand, already in the tape
+                        pending.pop_back();
+                        continue;
+                    }
+
+                    if (operation && !operands_ready) {
+                        pending.back().second = true;
+                        for (size_t i = operation->operand_count(); i-- > 0; )
+                            pending.push_back({operation->operand(i).get(), false});
+                        continue;
+                    }
+
+                    pending.pop_back();
+                    slot[node] = _instructions.size();
+
+                    if (operation && operation->is_nary()) {
+                        _instructions.push_back({false, operation->get_operation(), _operands.size(),
+                                                 operation->operand_count()});
+                        for (size_t i = 0; i < operation->operand_count(); i++)
+                            _operands.push_back(slot[operation->operand(i).get()]);
+                    } else if (operation && operation->is_unary()) {
+                        _instructions.push_back({false, operation->get_operation(), slot[operation->lhs().get()], 0,
+                                                 operation->exponent()});
+                    } else if (operation) {
+                        _instructions.push_back({false, operation->get_operation(), slot[operation->lhs().get()],
+                                                 slot[operation->rhs().get()]});
+                    } else {
+                        _instructions.push_back({true, OPERATION::ADDITION, _leaves.size(), 0});
+                        _leaves.push_back(node->get_precision_itr().cbegin());
+                    }
+                }
+
+                _intervals.resize(_instructions.size());
+                evaluate(0);
+            }
+
+            /// number of instructions of the tape, one per distinct node of the tree
+            size_t size() const {
+                return _instructions.size();
+            }
+
+            /// the precision the tape was evaluated at
+            precision_t precision() const {
+                return _precision;
+            }
+
+            precision_t maximum_precision() const {
+                return _maximum_precision;
+            }
+
+            /// the approximation interval of the compiled number at the current precision
+            const interval<T>& get_interval() const {
+                return _intervals.back();
+            }
+
+            /**
+             * @brief Refines the whole tape n precision steps, as n increments of the precision iterator
+             * of the number would do.
+             *
+             * @throws boost::real::divergent_division_result_exception if a divisor still contains zero
+             * at the maximum precision.
+             */
+            void iterate_n_times(int n) {
+                evaluate(n);
+            }
+
+            void operator++() {
+                evaluate(1);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_REAL_TAPE_HPP
@@ -0,0 +1,218 @@
+#ifndef BOOST_REAL_RECIPROCAL_CACHE_HPP
+#define BOOST_REAL_RECIPROCAL_CACHE_HPP
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <real/exact_number.hpp>
+#include <real/interval.hpp>
+#include <real/real_exception.hpp>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief Opt-in cache of the reciprocals of the exact divisors. When it is enabled, a quotient
+         * whose divisor is a number, not an interval, is calculated as the dividend times an enclosure
+         * of the reciprocal of the divisor, which is calculated once per divisor value and shared by
+         * every division by it, in every tree.
+         *
+         * @details The reciprocals are calculated with Newton's iteration x = x + x * (1 - d * x), which
+         * doubles the correct digits on each step, and the enclosure is then made exact by comparing
+         * d * x with one. Each divisor keeps the enclosure with the most digits calculated so far, and
+         * a more precise one is refined from it, so increasing the precision only takes the last steps.
+         */
+        template <typename T = int>
+        class reciprocal_cache {
+            struct entry {
+                size_t precision = 0;
+                exact_number<T> lower;
+                exact_number<T> upper;
+            };
+
+            // a divisor is keyed by the digits and the exponent of its absolute value
+            struct key_hash {
+                size_t operator()(const std::pair<std::vector<T>, int>& k) const {
+                    size_t result = std::hash<int>()(k.second);
+                    for (T digit : k.first)
+                        result ^= std::hash<T>()(digit) + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+                    return result;
+                }
+            };
+
+            using key = std::pair<std::vector<T>, int>;
+
+            inline static std::mutex _mutex;
+            inline static std::unordered_map<key, entry, key_hash> _entries;
+
+            static T base() {
+                return (std::numeric_limits<T>::max() / 4) * 2;
+            }
+
+            static exact_number<T> one() {
+                return exact_number<T>(std::vector<T>{1}, 1);
+            }
+
+            static bool is_zero(const exact_number<T>& x) {
+                return std::all_of(x.digits.begin(), x.digits.end(), [] (T digit) { return digit == 0; });
+            }
+
+            // keeps the first n digits of x
+            static void truncate(exact_number<T>& x, size_t n) {
+                x.normalize();
+                if (x.digits.size() > n)
+                    x.digits.resize(n);
+                x.normalize();
+            }
+
+            // 1 / d with the two or three digits a long double holds, d positive and normalized
+            static exact_number<T> estimation(const exact_number<T>& d) {
+                long double mantissa = 0;
+                long double scale = 1;
+                for (size_t i = 0; i < std::min<size_t>(d.digits.size(), 3); i++) {
+                    mantissa += d.digits[i] * scale;
+                    scale /= base();
+                }
+
+                // 1 / mantissa is in (1 / base, 1], its digits after the point
+                long double reciprocal = 1 / mantissa;
+                exact_number<T> result;
+                result.exponent = 0;
+                for (int i = 0; i < 2; i++) {
+                    reciprocal *= base();
+                    T digit = std::min<T>((T) reciprocal, base() - 1);
+                    result.digits.push_back(digit);
+                    reciprocal -= digit;
+                }
+
+                // d = mantissa * base^(exponent - 1)
+                result.exponent -= d.exponent - 1;
+                result.normalize();
+                return result;
+            }
+
+            // the enclosure of 1 / d with n digits, refined from x, which has its first correct digits
+            // correct, d positive and normalized
+            static entry refine(const exact_number<T>& d, exact_number<T> x, size_t correct, size_t n) {
+                // Newton's steps, keeping a couple of guard digits
+                while (correct < n + 1) {
+                    correct = std::min(2 * correct, n + 1);
+                    exact_number<T> error = one() - d * x;
+                    error.normalize();
+                    x = x + x * error;
+                    truncate(x, correct + 2);
+                }
+
+                // lower <= 1 / d < lower + ulp, checked exactly
+                truncate(x, n);
+                exact_number<T> ulp(std::vector<T>{1}, x.exponent - (int) n + 1);
+
+                auto product = [&d] (const exact_number<T>& y) {
+                    exact_number<T> result = d * y;
+                    result.normalize();
+                    return result;
+                };
+
+                entry result;
+                result.precision = n;
+                result.lower = x;
+                while (one() < product(result.lower)) {
+                    result.lower = result.lower - ulp;
+                    result.lower.normalize();
+                }
+
+                while (true) {
+                    exact_number<T> next = result.lower + ulp;
+                    next.normalize();
+                    if (one() < product(next))
+                        break;
+                    result.lower = next;
+                }
+
+                result.upper = result.lower;
+                if (product(result.lower) != one()) {
+                    result.upper = result.lower + ulp;
+                    result.upper.normalize();
+                }
+
+                return result;
+            }
+
+        public:
+            /**
+             * @brief When set, the quotients whose divisor is a number are calculated as products with
+             * the cached reciprocal of the divisor.
+             */
+            inline static bool enabled = false;
+
+            /// the number of divisors cached before the cache is cleared
+            inline static size_t capacity = 1024;
+
+            /**
+             * @brief An enclosure of 1 / divisor with at least precision digits, calculated from the
+             * most precise one cached for the divisor.
+             *
+             * @throws boost::real::divide_by_zero if divisor is zero.
+             */
+            static interval<T> reciprocal(const exact_number<T>& divisor, size_t precision) {
+                exact_number<T> d = divisor.abs();
+                d.normalize();
+                if (is_zero(d))
+                    throw boost::real::divide_by_zero();
+
+                key k(d.digits, d.exponent);
+                entry cached;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    auto it = _entries.find(k);
+                    if (it != _entries.end())
+                        cached = it->second;
+                }
+
+                if (cached.precision < precision) {
+                    if (cached.precision > 0)
+                        cached = refine(d, cached.lower, cached.precision, precision);
+                    else
+                        cached = refine(d, estimation(d), 1, precision);
+
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (_entries.size() >= capacity)
+                        _entries.clear();
+
+                    entry& stored = _entries[k];
+                    if (stored.precision < cached.precision)
+                        stored = cached;
+                }
+
+                interval<T> result;
+                result.lower_bound = cached.lower;
+                result.upper_bound = cached.upper;
+                if (!divisor.positive) {
+                    result.lower_bound.positive = false;
+                    result.upper_bound.positive = false;
+                    result.swap_bounds();
+                }
+                return result;
+            }
+
+            /// number of cached divisors
+            static size_t size() {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _entries.size();
+            }
+
+            /// drops every cached reciprocal
+            static void clear() {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _entries.clear();
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_RECIPROCAL_CACHE_HPP
@@ -0,0 +1,176 @@
+#ifndef BOOST_REAL_WORK_STEALING_POOL_HPP
+#define BOOST_REAL_WORK_STEALING_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace boost {
+    namespace real {
+
+        /**
+         * @brief A fixed size thread pool where every worker owns a task deque. Workers take their own
+         * tasks from the back of their deque and, when it is empty, steal from the front of the others.
+         *
+         * @details The pool is only used by the opt-in boost::real::parallel_evaluator, nothing in
+         * boost::real::real depends on it.
+         */
+        class work_stealing_pool {
+            struct task_queue {
+                std::mutex mutex;
+                std::deque<std::function<void()>> tasks;
+            };
+
+            std::vector<std::unique_ptr<task_queue>> _queues;
+            std::vector<std::thread> _workers;
+
+            std::mutex _sleep_mutex;
+            std::condition_variable _wake_up;
+            std::atomic<size_t> _queued_tasks = 0;
+            std::atomic<size_t> _next_queue = 0;
+            bool _stop = false;
+
+            bool pop(size_t index, std::function<void()>& task) {
+                task_queue& queue = *_queues[index];
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                    return false;
+
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --_queued_tasks;
+                return true;
+            }
+
+            bool steal(size_t thief, std::function<void()>& task) {
+                for (size_t i = 1; i <= _queues.size(); i++) {
+                    task_queue& queue = *_queues[(thief + i) % _queues.size()];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if (!queue.tasks.empty()) {
+                        task = std::move(queue.tasks.front());
+                        queue.tasks.pop_front();
+                        --_queued_tasks;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void push(std::function<void()> task) {
+                task_queue& queue = *_queues[_next_queue++ % _queues.size()];
+                {
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.tasks.push_back(std::move(task));
+                    ++_queued_tasks;
+                }
+
+                std::lock_guard<std::mutex> lock(_sleep_mutex);
+                _wake_up.notify_one();
+            }
+
+            void work(size_t index) {
+                std::function<void()> task;
+
+                while (true) {
+                    if (pop(index, task) || steal(index, task)) {
+                        task();
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(_sleep_mutex);
+                    _wake_up.wait(lock, [this] { return _stop || _queued_tasks > 0; });
+                    if (_stop && _queued_tasks == 0)
+                        return;
+                }
+            }
+
+        public:
+            /**
+             * @brief Starts the worker threads.
+             *
+             * @param threads - number of workers. With zero workers every task runs in the calling thread.
+             */
+            explicit work_stealing_pool(size_t threads = std::thread::hardware_concurrency()) {
+                for (size_t i = 0; i < std::max<size_t>(threads, 1); i++)
+                    _queues.push_back(std::make_unique<task_queue>());
+
+                for (size_t i = 0; i < threads; i++)
+                    _workers.emplace_back([this, i] { this->work(i); });
+            }
+
+            work_stealing_pool(const work_stealing_pool&) = delete;
+            work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+            /// finishes the queued tasks and joins the workers
+            ~work_stealing_pool() {
+                {
+                    std::lock_guard<std::mutex> lock(_sleep_mutex);
+                    _stop = true;
+                }
+                _wake_up.notify_all();
+
+                for (std::thread& worker : _workers)
+                    worker.join();
+            }
+
+            size_t size() const {
+                return _workers.size();
+            }
+
+            /**
+             * @brief Runs body(begin, end) over [0, count) split in chunks of grain_size indexes, and
+             * waits until all of them finished. The calling thread executes chunks too while it waits.
+             * If count is not bigger than grain_size, or the pool has no workers, it runs inline.
+             *
+             * @throws the first exception thrown by body, once every chunk finished.
+             */
+            template <typename F>
+            void parallel_for(size_t count, size_t grain_size, F&& body) {
+                grain_size = std::max<size_t>(grain_size, 1);
+                if (count <= grain_size || _workers.empty()) {
+                    body(size_t(0), count);
+                    return;
+                }
+
+                std::atomic<size_t> remaining = (count + grain_size - 1) / grain_size;
+                std::exception_ptr error;
+                std::mutex error_mutex;
+
+                for (size_t begin = 0; begin < count; begin += grain_size) {
+                    size_t end = std::min(begin + grain_size, count);
+                    push([&, begin, end] {
+                        try {
+                            body(begin, end);
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(error_mutex);
+                            if (!error)
+                                error = std::current_exception();
+                        }
+                        --remaining;
+                    });
+                }
+
+                // help instead of blocking, the chunks of this call may be stolen from any queue
+                std::function<void()> task;
+                while (remaining > 0) {
+                    if (steal(0, task))
+                        task();
+                    else
+                        std::this_thread::yield();
+                }
+
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        };
+    }
+}
+
+#endif // BOOST_REAL_WORK_STEALING_POOL_HPP
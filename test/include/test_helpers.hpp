@@ -46,4 +46,12 @@ int one_one_one(unsigned int n) {
     return 0;
 }
 
+int digit_requests = 0;
+
+// 0.111... in the internal base, counting how many digits were requested
+int counted_ones(unsigned int n) {
+    digit_requests++;
+    return 1;
+}
+
 #endif //BOOST_REAL_TEST_HELPERS_HPP
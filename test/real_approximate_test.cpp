@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+// checks that the interval is at most base^error_exponent wide and that it
+// overlaps the interval obtained by the usual precision iteration
+template <typename T>
+void check_approximation(boost::real::real<T> number, boost::real::real<T> copy, int error_exponent) {
+    boost::real::interval<T> approximation = number.approximate(error_exponent);
+    boost::real::exact_number<T> max_width(std::vector<T>{1}, error_exponent + 1);
+
+    CHECK(approximation.lower_bound <= approximation.upper_bound);
+    CHECK(approximation.upper_bound - approximation.lower_bound <= max_width);
+
+    boost::real::interval<T> iterated = copy.get_real_itr().cend().get_interval();
+    CHECK_FALSE(approximation < iterated);
+    CHECK_FALSE(iterated < approximation);
+}
+
+TEMPLATE_TEST_CASE("Demand-driven refinement", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("Explicit numbers are fully refined") {
+        real a("123456789123456789123456789");
+        boost::real::interval<TestType> approximation = a.approximate(-3);
+
+        CHECK(approximation.is_a_number());
+        CHECK(approximation.lower_bound.as_string() == "123456789123456789123456789");
+    }
+
+    SECTION("Addition") {
+        real a("1");
+        real b("3");
+        real c("2.75");
+        check_approximation(a / b + c, a / b + c, -4);
+    }
+
+    SECTION("Subtraction") {
+        real a("2");
+        real b("7");
+        real c("-123456789.5");
+        check_approximation(c - a / b, c - a / b, -4);
+    }
+
+    SECTION("Multiplication of numbers with different magnitudes") {
+        real a("1");
+        real b("3");
+        real c("12345678912345678912345678.25");
+        check_approximation(a / b * c, a / b * c, -3);
+    }
+
+    SECTION("Division") {
+        real a("1");
+        real b("3");
+        check_approximation(a / b, a / b, -5);
+    }
+
+    SECTION("Composed operations") {
+        real a("1");
+        real b("3");
+        real c("2.5");
+        real d("-0.000000000001");
+        check_approximation((a / b + c) * d - a, (a / b + c) * d - a, -3);
+    }
+
+    SECTION("Deep trees split the error without running out of digits") {
+        // a chain of 16 subtractions, each level only halves the budgets of its operands
+        auto chain = [] () {
+            real third = real("1") / real("3");
+            real x = real::placeholder(third);
+            for (int i = 0; i < 16; i++)
+                x = real::placeholder(third) - x;
+            return x;
+        };
+
+        check_approximation(chain(), chain(), -2);
+        check_approximation(chain(), chain(), -8);
+    }
+
+    SECTION("The error cannot be reached before the maximum precision") {
+        real a("1");
+        real b("3");
+        real c = a / b;
+
+        CHECK_THROWS_AS(c.approximate(-20), boost::real::precision_exception);
+    }
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+template <typename T>
+bool encloses(const boost::real::interval<T>& outer, const boost::real::interval<T>& inner) {
+    return !(inner.lower_bound < outer.lower_bound) && !(outer.upper_bound < inner.upper_bound);
+}
+
+template <typename T>
+bool intersect(const boost::real::interval<T>& x, const boost::real::interval<T>& y) {
+    return !(x.upper_bound < y.lower_bound) && !(y.upper_bound < x.lower_bound);
+}
+
+// enables the ball arithmetic evaluation while in scope
+template <typename T>
+struct ball_arithmetic_mode {
+    ball_arithmetic_mode() { boost::real::const_precision_iterator<T>::ball_arithmetic = true; }
+    ~ball_arithmetic_mode() { boost::real::const_precision_iterator<T>::ball_arithmetic = false; }
+};
+
+TEMPLATE_TEST_CASE("Ball arithmetic", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using ball=boost::real::ball<TestType>;
+
+    real a("1");
+    real b("3");
+    real c("-7");
+    real third = a / b;
+    real seventh = a / c;
+
+    boost::real::const_precision_iterator<TestType> third_it = third.get_real_itr().cbegin();
+    boost::real::const_precision_iterator<TestType> seventh_it = seventh.get_real_itr().cbegin();
+    third_it.iterate_n_times(3);
+    seventh_it.iterate_n_times(3);
+
+    SECTION("Balls enclose the interval they are built from") {
+        CHECK(encloses(ball(third_it.get_interval()).to_interval(), third_it.get_interval()));
+        CHECK(encloses(ball(seventh_it.get_interval()).to_interval(), seventh_it.get_interval()));
+        CHECK(encloses(ball(b.get_real_itr().get_interval()).to_interval(), b.get_real_itr().get_interval()));
+    }
+
+    SECTION("Truncated balls enclose the original one") {
+        ball x(third_it.get_interval());
+        CHECK(encloses(x.up_to(2).to_interval(), x.to_interval()));
+    }
+
+    SECTION("Operations enclose the interval arithmetic results") {
+        ball x(third_it.get_interval());
+        ball y(seventh_it.get_interval());
+
+        real sum = third + seventh;
+        real difference = third - seventh;
+        real product = third * seventh;
+        real quotient = third / seventh;
+
+        for (auto [result, expected] : {std::make_pair(x + y, sum), std::make_pair(x - y, difference),
+                                        std::make_pair(x * y, product), std::make_pair(x.divide(y, 10), quotient)}) {
+            CHECK(encloses(result.to_interval(), expected.get_real_itr().cend().get_interval()));
+            CHECK_FALSE(result.contains_zero());
+        }
+    }
+
+    SECTION("Dividing by a ball around zero throws") {
+        ball zero(boost::real::exact_number<TestType>(), b.get_real_itr().get_interval().lower_bound);
+        CHECK(zero.contains_zero());
+        CHECK_THROWS_AS(ball(third_it.get_interval()).divide(zero, 10),
+                        boost::real::divergent_division_result_exception);
+    }
+}
+
+TEMPLATE_TEST_CASE("Ball arithmetic evaluation", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    auto tree = [] () {
+        real a("1");
+        real b("3");
+        real c("-7");
+        real d("5");
+        real x = (a / b) * (c / d);
+        return x * x - x / (b + c) + a / c;
+    };
+
+    SECTION("Operation trees are enclosed with a similar width") {
+        real with_intervals = tree();
+        boost::real::interval<TestType> expected = with_intervals.get_real_itr().cend().get_interval();
+
+        ball_arithmetic_mode<TestType> mode;
+        real with_balls = tree();
+        boost::real::interval<TestType> result = with_balls.get_real_itr().cend().get_interval();
+
+        CHECK(intersect(result, expected));
+
+        boost::real::exact_number<TestType> four(std::vector<TestType>{4}, 1);
+        CHECK(result.width() < expected.width() * four);
+    }
+
+    SECTION("Comparisons") {
+        ball_arithmetic_mode<TestType> mode;
+        real a("1");
+        real b("3");
+        real c("2");
+
+        CHECK(a / b < a / c);
+        CHECK(a / b * c > a / c / b);
+        CHECK(a / b * b < c);
+    }
+}
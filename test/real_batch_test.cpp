@@ -0,0 +1,70 @@
+#include <catch2/catch.hpp>
+#include <real/real_batch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Batch evaluation", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::ORDERING;
+
+    real x = real::placeholder(real("1"));
+    real y = real::placeholder(real("1"));
+    real third = real("1") / real("3");
+    real f = (x * y + third) / (y + real("1"));
+
+    std::vector<real> xs = {real("1"), real("-2.5"), real("1000000"), real("0")};
+    std::vector<real> ys = {real("2"), real("1"), real("3"), real("5")};
+
+    boost::real::real_batch<TestType> batch(f, {x, y});
+
+    SECTION("Only the nodes that depend on the inputs are evaluated for each lane") {
+        // x, y, x * y, the constant third, the sum, the constant 1, y + 1 and the quotient
+        CHECK(batch.size() == 8);
+    }
+
+    SECTION("The lanes enclose the expression") {
+        batch.evaluate({xs, ys});
+        REQUIRE(batch.lanes() == 4);
+
+        // the doubles nearest to 7 / 9, -13 / 12, 750000 + 1 / 12 and 1 / 18
+        double expected[] = {7.0 / 9, -13.0 / 12, 750000 + 1.0 / 12, 1.0 / 18};
+
+        for (size_t lane = 0; lane < batch.lanes(); lane++) {
+            boost::real::double_interval enclosure = batch.enclosure(lane);
+
+            CHECK(enclosure.lower <= expected[lane]);
+            CHECK(expected[lane] <= enclosure.upper);
+            CHECK(enclosure.upper - enclosure.lower < 1e-9 * (std::abs(expected[lane]) + 1));
+        }
+    }
+
+    SECTION("Comparisons") {
+        batch.evaluate({xs, ys});
+        std::vector<ORDERING> orderings = batch.compare(real("0.5"));
+
+        // 0.7777..., -1.08333..., 750000.08333..., 0.05555...
+        CHECK(orderings == std::vector<ORDERING>{ORDERING::GREATER, ORDERING::LESS, ORDERING::GREATER, ORDERING::LESS});
+
+        // lane 0 is 7 / 9, the double intervals do not tell it apart from these numbers
+        CHECK(batch.compare(real("0.77777777777777777777"))[0] == ORDERING::GREATER);
+        CHECK(batch.compare(real("0.77777777777777777778"))[0] == ORDERING::LESS);
+    }
+
+    SECTION("Lanes are bound to the expression") {
+        batch.evaluate({xs, ys});
+        CHECK(batch.bind(1) > real("-10834e-4"));
+        CHECK(batch.bind(1) < real("-10833e-4"));
+    }
+
+    SECTION("Divisors containing zero give the whole line") {
+        batch.evaluate({{real("1")}, {real("-1")}});
+        CHECK(batch.enclosure(0).lower == -std::numeric_limits<double>::infinity());
+        CHECK(batch.enclosure(0).upper == std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("Every placeholder is given the same lanes") {
+        CHECK_THROWS_AS(batch.evaluate({xs}), boost::real::invalid_representation_exception);
+        CHECK_THROWS_AS(batch.evaluate({xs, {real("1")}}), boost::real::invalid_representation_exception);
+        CHECK_THROWS_AS(boost::real::real_batch<TestType>(f, {third}), boost::real::bad_variant_access_exception);
+    }
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Three-way compare", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::ORDERING;
+
+    SECTION("Explicit numbers") {
+        real a("1.5");
+        real b("2.5");
+        real c("2.5");
+
+        CHECK(a.compare(b) == ORDERING::LESS);
+        CHECK(b.compare(a) == ORDERING::GREATER);
+        CHECK(b.compare(c) == ORDERING::EQUAL);
+    }
+
+    SECTION("Operations") {
+        real a("11111111111110000000000");
+        real b("11111111111110000000000");
+        real c("22222222222220000000000");
+        real d = a + b;
+        real e = a * b;
+
+        CHECK(d.compare(c) == ORDERING::EQUAL);
+        CHECK(c.compare(e) == ORDERING::LESS);
+        CHECK(e.compare(d) == ORDERING::GREATER);
+    }
+
+    SECTION("Same number") {
+        real a("1.555555555555555555");
+        real b = a;
+
+        CHECK(a.compare(b) == ORDERING::EQUAL);
+        CHECK(a == b);
+    }
+
+    SECTION("Undecided") {
+        real a = real("14") / real("9");
+        real b = real("14") / real("9");
+
+        CHECK(a.compare(b) == ORDERING::UNDECIDED);
+        CHECK_THROWS_AS(a < b, boost::real::precision_exception);
+        CHECK_THROWS_AS(a > b, boost::real::precision_exception);
+        CHECK_THROWS_AS(a == b, boost::real::precision_exception);
+    }
+
+    SECTION("Relational operators agree with compare") {
+        real a("-3.25");
+        real b("1.75");
+
+        CHECK(a < b);
+        CHECK_FALSE(a > b);
+        CHECK_FALSE(a == b);
+        CHECK(b > a);
+        CHECK_FALSE(b < a);
+    }
+}
+
+TEMPLATE_TEST_CASE("Non throwing comparisons", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::ORDERING;
+
+    boost::real::exact_number<TestType> zero;
+
+    SECTION("Decided comparisons") {
+        real a("1.5");
+        real b("2.5");
+
+        auto less = a.try_less(b);
+        REQUIRE(less.value.has_value());
+        CHECK(less.value.value());
+
+        auto equal = a.try_equal(b);
+        REQUIRE(equal.value.has_value());
+        CHECK_FALSE(equal.value.value());
+
+        auto result = b.try_compare(a);
+        CHECK(result.ordering == ORDERING::GREATER);
+    }
+
+    SECTION("Fully represented numbers have zero width") {
+        real a("11111111111110000000000");
+        real b("11111111111110000000000");
+        real c("22222222222220000000000");
+        real d = a + b;
+
+        auto result = c.try_compare(d);
+        CHECK(result.ordering == ORDERING::EQUAL);
+        CHECK(result.width == zero);
+
+        auto equal = c.try_equal(d);
+        REQUIRE(equal.value.has_value());
+        CHECK(equal.value.value());
+    }
+
+    SECTION("Undecided comparisons do not throw") {
+        real a("1.555555555555555555");
+        real b("1.555555555555555555");
+
+        boost::real::predicate_result<TestType> less;
+        CHECK_NOTHROW(less = a.try_less(b));
+        CHECK_FALSE(less.value.has_value());
+        CHECK(zero < less.width);
+
+        boost::real::predicate_result<TestType> equal;
+        CHECK_NOTHROW(equal = a.try_equal(b));
+        CHECK_FALSE(equal.value.has_value());
+
+        auto result = a.try_compare(b);
+        CHECK(result.ordering == ORDERING::UNDECIDED);
+        CHECK(result.width == less.width);
+    }
+}
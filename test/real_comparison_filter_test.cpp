@@ -0,0 +1,86 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEST_CASE("Double intervals") {
+    using boost::real::double_interval;
+
+    SECTION("Digits not representable as doubles are enclosed") {
+        long long digit = (1LL << 60) + 1;
+        double_interval x = double_interval::from_digit(digit);
+
+        CHECK(x.lower < x.upper);
+        CHECK((long double) x.lower <= (long double) digit);
+        CHECK((long double) digit <= (long double) x.upper);
+    }
+
+    SECTION("Operations are rounded outwards") {
+        double_interval one(1, 1);
+        double_interval three(3, 3);
+        double_interval third = one / three;
+
+        CHECK(third.lower < third.upper);
+        CHECK(third.lower <= 1.0 / 3.0);
+        CHECK(1.0 / 3.0 <= third.upper);
+        CHECK((third * three).contains_zero() == false);
+        CHECK((third * three - one).contains_zero());
+    }
+
+    SECTION("Undefined operations decide nothing") {
+        double_interval around_zero(-1, 1);
+        double_interval unbounded(0, std::numeric_limits<double>::infinity());
+
+        CHECK(std::isinf((double_interval(1, 1) / around_zero).upper));
+        CHECK(std::isinf((unbounded * double_interval(0, 0)).lower));
+    }
+}
+
+TEST_CASE("Comparison filter") {
+
+    using real=boost::real::real<int>;
+
+    SECTION("Numbers far apart are compared without refining them") {
+        real ones(counted_ones, 0);
+        real two("2");
+        real x = ones * two + real("1") / real("3");
+        int requests = digit_requests;
+
+        CHECK(x < two);
+        CHECK(two > x);
+        CHECK(digit_requests == requests);
+    }
+
+    SECTION("Close numbers are refined") {
+        real ones(counted_ones, 0);
+        real x = ones + real("0.000000000000000000000000000001");
+        int requests = digit_requests;
+
+        CHECK(ones < x);
+        CHECK(digit_requests > requests);
+    }
+}
+
+TEMPLATE_TEST_CASE("Filtered comparisons", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("Same results as the exact comparisons") {
+        real a("1");
+        real b("3");
+        real third = a / b;
+        real almost_third("0.3333333333333333333333333333");
+
+        CHECK(almost_third < third);
+        CHECK(third > almost_third);
+        CHECK(real("-2") / b < almost_third - third);
+
+        for (int i = 1; i < 20; i++) {
+            real x = real(std::to_string(i)) / real(std::to_string(i + 1));
+            real y = real(std::to_string(i + 1)) / real(std::to_string(i + 2));
+
+            CHECK(x < y);
+            CHECK(y - x > x - y);
+            CHECK(x * y < y);
+        }
+    }
+}
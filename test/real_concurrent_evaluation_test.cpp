@@ -0,0 +1,107 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+#include <thread>
+
+// runs body(i) in n threads at once. Catch assertions are not thread safe, so the bodies only
+// record their results and the checks are done afterwards.
+template <typename F>
+void run_in_threads(int n, F body) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < n; i++)
+        threads.emplace_back(body, i);
+
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+TEMPLATE_TEST_CASE("Concurrent evaluation", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using interval=boost::real::interval<TestType>;
+
+    const int threads = 8;
+
+    // x, y and z share their nodes, w divides by a negative number
+    auto shared_tree = [] () {
+        real a("1");
+        real b("3");
+        real c("5");
+        real x = a / b;
+        real y = x * x + x;
+        real z = y * x - y;
+        real w = z / (b - c) + x;
+        return std::vector<real>{x, y, z, w};
+    };
+
+    SECTION("Numbers sharing subtrees evaluated by several threads") {
+        std::vector<real> numbers = shared_tree();
+        std::vector<real> expected = shared_tree();
+        std::vector<interval> results(threads);
+
+        run_in_threads(threads, [&](int i) {
+            results[i] = numbers[i % numbers.size()].get_real_itr().cend().get_interval();
+        });
+
+        for (int i = 0; i < threads; i++)
+            CHECK(results[i] == expected[i % expected.size()].get_real_itr().cend().get_interval());
+    }
+
+    SECTION("Comparisons of numbers sharing subtrees") {
+        std::vector<real> numbers = shared_tree();
+        std::vector<int> correct(threads, 0);
+
+        run_in_threads(threads, [&](int i) {
+            for (int repetition = 0; repetition < 4; repetition++) {
+                const real& x = numbers[0];
+                const real& y = numbers[1];
+                const real& z = numbers[2];
+                const real& w = numbers[3];
+
+                correct[i] += (x < y) + (z < x) + (y > z) + (x < w) + (y < w);
+            }
+        });
+
+        for (int i = 0; i < threads; i++)
+            CHECK(correct[i] == 20);
+    }
+
+    SECTION("Approximations of a shared number") {
+        std::vector<real> numbers = shared_tree();
+        std::vector<real> expected = shared_tree();
+        std::vector<interval> results(threads);
+
+        run_in_threads(threads, [&](int i) {
+            results[i] = numbers[3].approximate(-1);
+        });
+
+        for (int i = 0; i < threads; i++)
+            CHECK(results[i] == expected[3].approximate(-1));
+    }
+
+    SECTION("Interned chains released while other threads look them up") {
+        boost::real::node_table<TestType>::enabled = true;
+
+        real x = real::placeholder(real("1"));
+        real y = real::placeholder(real("2"));
+        std::vector<int> correct(threads, 0);
+
+        // every thread builds the same chain, so its nodes are handed out by the table while the
+        // other threads release their copies
+        run_in_threads(threads, [&](int i) {
+            for (int repetition = 0; repetition < 200; repetition++) {
+                real chain = x;
+                for (int j = 0; j < 50; j++)
+                    chain = chain - y;
+
+                correct[i] += chain.get_real_itr().cbegin().get_interval().lower_bound.as_string() == "-99";
+            }
+        });
+
+        boost::real::node_table<TestType>::enabled = false;
+
+        for (int i = 0; i < threads; i++)
+            CHECK(correct[i] == 200);
+    }
+}
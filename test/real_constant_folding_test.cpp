@@ -0,0 +1,97 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Constant folding", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    auto is_explicit = [] (real a) {
+        return std::holds_alternative<boost::real::real_explicit<TestType>>(a.get_real_number());
+    };
+
+    auto same_node = [] (real a, real b) {
+        return &a.get_real_number() == &b.get_real_number();
+    };
+
+    SECTION("Operations between explicit numbers are calculated once") {
+        real a = real("3") * real("4") + real("5");
+        CHECK(is_explicit(a));
+        CHECK(a == real("17"));
+
+        real b = real("-7") - real("12");
+        CHECK(is_explicit(b));
+        CHECK(b == real("-19"));
+
+        real c = real("123456789012") * real("987654321");
+        CHECK(is_explicit(c));
+        CHECK(c == real("121932631124487120852"));
+
+        real d = real("5") - real("5");
+        CHECK(is_explicit(d));
+        CHECK(d == real("0"));
+    }
+
+    SECTION("Assignment operators fold too") {
+        real sum("1");
+        real product("1");
+        for (int i = 2; i <= 10; i++) {
+            sum += real(std::to_string(i));
+            product *= real(std::to_string(i));
+        }
+
+        CHECK(is_explicit(sum));
+        CHECK(is_explicit(product));
+        CHECK(sum == real("55"));
+        CHECK(product == real("3628800"));
+
+        sum -= real("55");
+        CHECK(is_explicit(sum));
+        CHECK(sum == real("0"));
+    }
+
+    SECTION("Identities are eliminated") {
+        real x("1.5");
+        real zero("0");
+        real one("1");
+
+        CHECK(same_node(x + zero, x));
+        CHECK(same_node(zero + x, x));
+        CHECK(same_node(x - zero, x));
+        CHECK(same_node(x * one, x));
+        CHECK(same_node(one * x, x));
+
+        CHECK(is_explicit(x * zero));
+        CHECK(is_explicit(zero * x));
+        CHECK(x * zero == zero);
+
+        CHECK(is_explicit(x - x));
+        CHECK(x - x == zero);
+    }
+
+    SECTION("Other operations are not folded") {
+        real x("1.5");
+
+        CHECK_FALSE(is_explicit(real("0") - x));
+        CHECK_FALSE(is_explicit(x + real("1")));
+        CHECK_FALSE(is_explicit(real("1") / real("3")));
+        CHECK_FALSE(is_explicit(x + real("1") / real("3")));
+    }
+
+    SECTION("Decimal literals are folded into rational numbers") {
+        auto is_rational = [] (real a) {
+            return std::holds_alternative<boost::real::real_rational<TestType>>(a.get_real_number());
+        };
+
+        real x("1.5");
+        CHECK(is_rational(x + real("1")));
+        CHECK(is_rational(x * real("0.1")));
+        CHECK(x * real("0.1") == real("0.15"));
+
+        // integral results are explicit numbers
+        CHECK(is_explicit(x - real("1.5")));
+        CHECK(x - real("1.5") == real("0"));
+        CHECK(is_explicit(x * real("4")));
+        CHECK(x * real("4") == real("6"));
+    }
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Operation trees evaluation", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    const int depth = 4000;
+
+    // explicit operands are folded as the numbers are built, placeholders are kept as leaves
+    SECTION("Long accumulation chains") {
+        real a = real::placeholder(real("1"));
+        real b = real::placeholder(real("2"));
+        real sum("0");
+
+        for (int i = 0; i < depth; i++)
+            sum += (i % 2 == 0) ? a : b;
+
+        boost::real::const_precision_iterator<TestType> it = sum.get_real_itr().cbegin();
+        ++it;
+        ++it;
+
+        CHECK(it.get_interval().is_a_number());
+        CHECK(it.get_interval().lower_bound.as_string() == "6000");
+    }
+
+    SECTION("Long chains of mixed operations") {
+        real one = real::placeholder(real("1"));
+        real two = real::placeholder(real("2"));
+        real result("5");
+
+        for (int i = 0; i < depth; i++) {
+            if (i % 2 == 0)
+                result *= one;
+            else
+                result -= two;
+        }
+
+        CHECK(result.get_real_itr().cend().get_interval().lower_bound.as_string() == "-3995");
+    }
+
+    SECTION("Operands shared by several operations") {
+        real a("1");
+        real b("3");
+        real x = a / b;
+        real y = x * x + x;
+        real z = y * x - y;
+
+        // same tree without shared nodes
+        real w = ((a / b) * (a / b) + (a / b)) * (a / b) - ((a / b) * (a / b) + (a / b));
+
+        boost::real::const_precision_iterator<TestType> z_it = z.get_real_itr().cbegin();
+        boost::real::const_precision_iterator<TestType> w_it = w.get_real_itr().cbegin();
+
+        for (int i = 0; i < 6; i++) {
+            ++z_it;
+            ++w_it;
+
+            CHECK(z_it.get_interval() == w_it.get_interval());
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Deep operation trees", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    // deep enough to overflow the stack if evaluation or destruction recursed once per node. Chains of
+    // += and *= are flattened, binary subtractions of placeholders are neither flattened nor folded.
+    const int depth = 100000;
+
+    SECTION("Evaluating and releasing long chains") {
+        real a = real::placeholder(real("1"));
+        real b = real::placeholder(real("2"));
+
+        {
+            real chain("0");
+
+            for (int i = 0; i < depth; i++)
+                chain -= (i % 2 == 0) ? a : b;
+
+            boost::real::const_precision_iterator<TestType> it = chain.get_real_itr().cbegin();
+            ++it;
+
+            CHECK(it.get_interval().lower_bound.as_string() == "-150000");
+        }
+
+        // the operands shared with the released chain are still valid
+        CHECK(a.get_real_itr().cend().get_interval().lower_bound.as_string() == "1");
+    }
+
+    SECTION("Releasing chains that share a subtree with a live number") {
+        real a = real::placeholder(real("1"));
+        real b = real::placeholder(real("2"));
+        real shared = a + b;
+
+        {
+            real chain = shared;
+            for (int i = 0; i < depth; i++)
+                chain -= a;
+        }
+
+        CHECK(shared.get_real_itr().cend().get_interval().lower_bound.as_string() == "3");
+    }
+
+    SECTION("Approximating long chains") {
+        real third = real("1") / real("3");
+        real x = real::placeholder(third);
+        for (int i = 0; i < depth; i++)
+            x = real::placeholder(third) - x;
+
+        // the budgets of the deepest operands are too small to be reached, they are iterated instead
+        boost::real::interval<TestType> approximation = x.approximate(-2);
+        boost::real::exact_number<TestType> max_width(std::vector<TestType>{1}, -1);
+
+        // depth is even, so x = 1/3
+        CHECK(approximation.upper_bound - approximation.lower_bound <= max_width);
+        CHECK(real("0.33333") < x);
+        CHECK(x < real("0.33334"));
+    }
+}
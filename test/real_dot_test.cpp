@@ -0,0 +1,101 @@
+#include <catch2/catch.hpp>
+#include <string>
+#include <vector>
+
+#include <real/real.hpp>
+#include <real/real_batch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Dot products", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::OPERATION;
+
+    auto operation_of = [] (real x) {
+        return std::get_if<boost::real::real_operation<TestType>>(&x.get_real_number());
+    };
+
+    auto interval_of = [] (real x, int steps) {
+        auto it = x.get_real_itr().cbegin();
+        for (int i = 0; i < steps; i++)
+            ++it;
+        return it.get_interval();
+    };
+
+    real seven("7");
+
+    SECTION("A dot product is a single node") {
+        std::vector<real> a, b;
+        for (int i = 1; i <= 10; i++) {
+            a.push_back(real(std::to_string(i)) / seven);
+            b.push_back(real(std::to_string(i)));
+        }
+
+        real x = dot(a, b);
+        REQUIRE(operation_of(x) != nullptr);
+        CHECK(operation_of(x)->get_operation() == OPERATION::DOT);
+        CHECK(operation_of(x)->operand_count() == 20);
+
+        // 385 / 7 = 55
+        CHECK(real("54.999") < x);
+        CHECK(x < real("55.001"));
+    }
+
+    SECTION("Dot products of exact numbers are calculated exactly") {
+        std::vector<real> a = {real("1.5"), real("2"), real("-0.25")};
+        std::vector<real> b = {real("2"), real("3"), real("4")};
+        CHECK(operation_of(dot(a, b)) == nullptr);
+        CHECK(dot(a, b) == real("8"));
+
+        std::vector<real> c = {real("0.1"), real("0.2")};
+        std::vector<real> d = {real("0.1"), real("0.2")};
+        CHECK(dot(c, d) == real("0.05"));
+
+        CHECK(dot(std::vector<real>(), std::vector<real>()) == real("0"));
+        CHECK(dot(std::vector<real>{seven}, std::vector<real>{real("2")}) == real("14"));
+    }
+
+    SECTION("Dot products enclose the result as tightly as the binary tree") {
+        std::vector<real> a, b;
+        real binary = real("0");
+        for (int i = 1; i <= 8; i++) {
+            a.push_back(real("1") / real(std::to_string(i + 2)));
+            b.push_back(real("0") - real(std::to_string(i)) / seven);
+            binary = binary + a.back() * b.back();
+        }
+
+        boost::real::interval<TestType> fused = interval_of(dot(a, b), 3);
+        boost::real::interval<TestType> tree = interval_of(binary, 3);
+        CHECK(tree.lower_bound <= fused.lower_bound);
+        CHECK(fused.upper_bound <= tree.upper_bound);
+        CHECK(fused.lower_bound < fused.upper_bound);
+    }
+
+    SECTION("Tapes and batches evaluate dot products") {
+        real x = real::placeholder(real("1"));
+        real y = dot(std::vector<real>{x, real("1") / seven, x}, std::vector<real>{x, seven, real("3")});
+
+        boost::real::real_tape<TestType> tape = y.compile();
+        auto it = y.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+        for (int i = 0; i < 3; i++) {
+            ++tape;
+            ++it;
+            CHECK(tape.get_interval() == it.get_interval());
+        }
+
+        boost::real::real_batch<TestType> batch(y, {x});
+        batch.evaluate({{real("2"), real("-1")}});
+
+        // 4 + 1 + 6 and 1 + 1 - 3
+        CHECK(batch.enclosure(0).lower <= 11);
+        CHECK(11 <= batch.enclosure(0).upper);
+        CHECK(batch.enclosure(1).lower <= -1);
+        CHECK(-1 <= batch.enclosure(1).upper);
+    }
+
+    SECTION("Operands of different sizes are rejected") {
+        CHECK_THROWS_AS(dot(std::vector<real>{seven}, std::vector<real>{seven, seven}),
+                        boost::real::invalid_representation_exception);
+    }
+}
@@ -79,6 +79,25 @@ TEST_CASE("Create boost::real_explicit from strings") {
         }
     }
 
+    SECTION("Long numbers are converted back exactly") {
+
+        std::string number_str = "1";
+        for (int i = 0; i < 300; i++) {
+            number_str += std::to_string(i % 10);
+        }
+
+        boost::real::real_explicit<int> a(number_str);
+        boost::real::real_explicit<long long> b("-" + number_str + "e40");
+        CHECK( a.as_string() == number_str );
+        CHECK( b.as_string() == "-" + number_str + std::string(40, '0') );
+
+        // digits after the point are printed up to the first non zero ones of the exact fraction
+        boost::real::exact_number<int> half(std::vector<int>{536870911}, 0);
+        boost::real::exact_number<int> small(std::vector<int>{1, 536870911}, -1, false);
+        CHECK( half.as_string() == "0.5" );
+        CHECK( small.as_string().substr(0, 24) == "-0." + std::string(17, '0') + "1301" );
+    }
+
     SECTION("Invalid string") {
         //CHECK_THROWS_AS( boost::real::real_explicit a("12e23.2"));
     }
@@ -0,0 +1,79 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+// true if x <= y
+template <typename T>
+bool not_greater(const boost::real::exact_number<T>& x, const boost::real::exact_number<T>& y) {
+    boost::real::exact_number<T> difference = y - x;
+    return difference.positive ||
+           std::all_of(difference.digits.begin(), difference.digits.end(), [] (T digit) { return digit == 0; });
+}
+
+TEMPLATE_TEST_CASE("Fixed precision reals", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using fixed=boost::real::real_fixed<TestType, 4>;
+    using exact_number=boost::real::exact_number<TestType>;
+
+    TestType base = (std::numeric_limits<TestType>::max() / 4) * 2;
+
+    SECTION("Operations enclose the exact results") {
+        exact_number x({base - 1, 3, 0, 17, 5}, 1, true);
+        exact_number y({7, base / 3}, -1, false);
+        fixed fixed_x(x);
+        fixed fixed_y(y);
+
+        CHECK(fixed_x.lower() < fixed_x.upper());
+        CHECK(fixed_y.lower() == y);
+        CHECK(fixed_y.upper() == y);
+
+        exact_number sum = x + y;
+        exact_number difference = x - y;
+        exact_number product = x * y;
+
+        CHECK(not_greater((fixed_x + fixed_y).lower(), sum));
+        CHECK(not_greater(sum, (fixed_x + fixed_y).upper()));
+        CHECK(not_greater((fixed_x - fixed_y).lower(), difference));
+        CHECK(not_greater(difference, (fixed_x - fixed_y).upper()));
+        CHECK(not_greater((fixed_x * fixed_y).lower(), product));
+        CHECK(not_greater(product, (fixed_x * fixed_y).upper()));
+
+        // x / y is negative: upper * y <= x <= lower * y
+        fixed quotient = fixed_x / fixed_y;
+        CHECK(not_greater(quotient.upper() * y, x));
+        CHECK(not_greater(x, quotient.lower() * y));
+    }
+
+    SECTION("Results are rounded to the last digit") {
+        fixed third = fixed(exact_number({1}, 1)) / fixed(exact_number({3}, 1));
+        exact_number unit({1}, -3);
+
+        CHECK(third.lower() < third.upper());
+        CHECK(not_greater(third.upper() - third.lower(), unit));
+        CHECK((third * fixed(exact_number({3}, 1))).contains_zero() == false);
+    }
+
+    SECTION("Conversion from boost::real::real") {
+        real third = real("1") / real("3");
+        fixed enclosure = third.template fixed<4>();
+
+        CHECK(enclosure.bounded());
+        CHECK(real("0.3").template fixed<4>() < enclosure);
+        CHECK(enclosure < real("0.3334").template fixed<4>());
+        CHECK(enclosure.compare(fixed(third.approximate(-6))) == boost::real::ORDERING::UNDECIDED);
+        CHECK(real("2").template fixed<4>().compare(fixed(exact_number({2}, 1))) == boost::real::ORDERING::EQUAL);
+    }
+
+    SECTION("Divisions by intervals that contain zero are not bounded") {
+        fixed zero(exact_number({0}, 0));
+        fixed one(exact_number({1}, 1));
+        fixed unbounded = one / (one - one);
+
+        CHECK(zero.contains_zero());
+        CHECK(!unbounded.bounded());
+        CHECK(!(unbounded + one).bounded());
+        CHECK(unbounded.compare(one) == boost::real::ORDERING::UNDECIDED);
+        CHECK_THROWS_AS(unbounded.lower(), boost::real::precision_exception);
+    }
+}
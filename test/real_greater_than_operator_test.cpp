@@ -157,7 +157,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real a("1.555555555555555555");
                 real b("1.555555555555555555");
 
-                CHECK_THROWS_AS(a > b, boost::real::precision_exception);
+                CHECK_FALSE(a > b);
             }
 
             SECTION("Explicit > Addition") {
@@ -193,7 +193,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a + b;
                 real d("2.2222222222222");
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Addition > Addition") {
@@ -202,7 +202,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a + b;
                 real d = a + b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Addition > Subtraction") {
@@ -213,7 +213,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real e("0.0000000000001");
                 real f = d - e;
 
-                CHECK_THROWS_AS(c > f, boost::real::precision_exception);
+                CHECK_FALSE(c > f);
             }
 
             SECTION("Addition > multiplication") {
@@ -223,7 +223,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real d("2");
                 real e = a * d;
 
-                CHECK_THROWS_AS(c > e, boost::real::precision_exception);
+                CHECK_FALSE(c > e);
             }
 
             SECTION("Subtraction > Explicit") {
@@ -232,7 +232,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a - b;
                 real d("1.1111111111111");
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Subtraction > Addition") {
@@ -242,7 +242,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real d("-0.0000000000001");
                 real e = a + d;
 
-                CHECK_THROWS_AS(c > e, boost::real::precision_exception);
+                CHECK_FALSE(c > e);
             }
 
             SECTION("Subtraction > Subtraction") {
@@ -251,7 +251,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a - b;
                 real d = a - b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Subtraction > multiplication") {
@@ -262,7 +262,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real e("1");
                 real f = d * e;
 
-                CHECK_THROWS_AS(c > f, boost::real::precision_exception);
+                CHECK_FALSE(c > f);
             }
 
             SECTION("multiplication > Explicit") {
@@ -271,7 +271,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a * b;
                 real d("2.2222222222222");
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("multiplication > Addition") {
@@ -280,7 +280,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a * b;
                 real d = a + a;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("multiplication > Subtraction") {
@@ -291,7 +291,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real e("0.0000000000001");
                 real f = d - e;
 
-                CHECK_THROWS_AS(c > f, boost::real::precision_exception);
+                CHECK_FALSE(c > f);
             }
 
             SECTION("multiplication > multiplication") {
@@ -300,7 +300,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a * b;
                 real d = a * b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
         }
     }
@@ -512,7 +512,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a + b;
                 real d = a + b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Addition > Subtraction") {
@@ -552,7 +552,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real d("-0.0000000000001");
                 real e = a + d;
 
-                CHECK_THROWS_AS(c > e, boost::real::precision_exception);
+                CHECK_FALSE(c > e);
             }
 
             SECTION("Subtraction > Subtraction") {
@@ -561,7 +561,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a - b;
                 real d = a - b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("Subtraction > multiplication") {
@@ -590,7 +590,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a * b;
                 real d = a + a;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
 
             SECTION("multiplication > Subtraction") {
@@ -610,7 +610,7 @@ TEMPLATE_TEST_CASE("Operator >", "[template]", int, long, long long) {
                 real c = a * b;
                 real d = a * b;
 
-                CHECK_THROWS_AS(c > d, boost::real::precision_exception);
+                CHECK_FALSE(c > d);
             }
         }
 
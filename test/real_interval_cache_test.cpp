@@ -0,0 +1,75 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Shared subexpressions", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("Shared operands give the same intervals as separate ones") {
+        real a("1");
+        real b("3");
+
+        real shared = a / b;
+        real x = shared + shared * shared;
+        real y = a / b + (a / b) * (a / b);
+
+        auto x_it = x.get_real_itr().cbegin();
+        auto y_it = y.get_real_itr().cbegin();
+
+        for (int i = 0; i < 8; i++) {
+            ++x_it;
+            ++y_it;
+            CHECK(x_it.get_interval() == y_it.get_interval());
+        }
+    }
+
+    SECTION("Repeated comparisons reuse the operation intervals") {
+        real a("1");
+        real b("3");
+        real c("0.3");
+        real x = a / b;
+        real y = x * x - c;
+
+        for (int i = 0; i < 3; i++) {
+            CHECK(c < x);
+            CHECK(y < x);
+            CHECK(x.compare(y) == boost::real::ORDERING::GREATER);
+        }
+    }
+
+    SECTION("Intervals still shrink when iterating from cbegin again") {
+        real a("1");
+        real b("7");
+        real x = a / b + a;
+
+        auto first = x.get_real_itr().cbegin();
+        for (int i = 0; i < 5; i++)
+            ++first;
+
+        auto it = x.get_real_itr().cbegin();
+        boost::real::interval<TestType> previous = it.get_interval();
+        for (int i = 0; i < 8; i++) {
+            ++it;
+            CHECK(previous.lower_bound <= it.get_interval().lower_bound);
+            CHECK(it.get_interval().upper_bound <= previous.upper_bound);
+            previous = it.get_interval();
+        }
+    }
+
+    SECTION("Changing the maximum precision invalidates the cached intervals") {
+        real a("1");
+        real b("3");
+        real x = a / b;
+        real y = a / b;
+
+        boost::real::interval<TestType> low_precision = x.get_real_itr().cend().get_interval();
+
+        x.set_maximum_precision(20);
+        y.set_maximum_precision(20);
+        boost::real::interval<TestType> high_precision = x.get_real_itr().cend().get_interval();
+
+        CHECK(high_precision == y.get_real_itr().cend().get_interval());
+        CHECK(low_precision.width() > high_precision.width());
+    }
+}
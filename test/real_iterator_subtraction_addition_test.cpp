@@ -8,10 +8,10 @@ TEMPLATE_TEST_CASE("Operators - + boost::real::const_precision_iterator", "[temp
     
     using real=boost::real::real<TestType>;
 
-    // Explicit numbers
-    real a("9999999999999999999999999999999");
-    real b("9999999999999999999999999999999");
-    real c("9999999999999999999999999999999");
+    // Explicit numbers, behind placeholders so the operations between them are not folded
+    real a = real::placeholder(real("9999999999999999999999999999999"));
+    real b = real::placeholder(real("9999999999999999999999999999999"));
+    real c = real::placeholder(real("9999999999999999999999999999999"));
 
     SECTION("(a - b) + c") {
         real result = (a - b) + c;
@@ -0,0 +1,119 @@
+#include <catch2/catch.hpp>
+#include <string>
+
+#include <real/real.hpp>
+#include <real/real_batch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("N-ary sums and products", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::OPERATION;
+
+    auto operation_of = [] (real x) {
+        return std::get_if<boost::real::real_operation<TestType>>(&x.get_real_number());
+    };
+
+    real seven("7");
+
+    SECTION("Assignment operators flatten into a single node") {
+        real sum = real("1") / seven;
+        real product = real("2") / real("1");
+        for (int i = 2; i <= 100; i++) {
+            sum += real(std::to_string(i)) / seven;
+            product *= real(std::to_string(i + 1)) / real(std::to_string(i));
+        }
+
+        REQUIRE(operation_of(sum) != nullptr);
+        CHECK(operation_of(sum)->get_operation() == OPERATION::SUM);
+        CHECK(operation_of(sum)->operand_count() == 100);
+
+        REQUIRE(operation_of(product) != nullptr);
+        CHECK(operation_of(product)->get_operation() == OPERATION::PRODUCT);
+        CHECK(operation_of(product)->operand_count() == 100);
+
+        // 5050 / 7 = 721.428..., the product telescopes to 101
+        CHECK(real("721.42") < sum);
+        CHECK(sum < real("721.43"));
+        CHECK(real("100") < product);
+        CHECK(product < real("102"));
+    }
+
+    SECTION("Sums agree with the binary additions") {
+        real sum = real("1") / seven;
+        real binary = real("1") / seven;
+        for (int i = 2; i <= 20; i++) {
+            sum += real(std::to_string(i)) / seven;
+            binary = binary + real(std::to_string(i)) / seven;
+        }
+
+        // 210 / 7 = 30
+        CHECK(real("29.999") < sum);
+        CHECK(sum < real("30.001"));
+        CHECK(real("1") / seven + sum > binary);
+        CHECK(sum - real("1") / seven < binary);
+    }
+
+    SECTION("Shared nodes are copied before appending") {
+        real sum = real("1") / seven;
+        sum += real("2") / seven;
+
+        real partial = sum;
+        sum += real("4") / seven;
+
+        CHECK(operation_of(partial)->operand_count() == 2);
+        CHECK(operation_of(sum)->operand_count() == 3);
+        CHECK(real("0.4") < partial);
+        CHECK(partial < real("0.5"));
+        CHECK(real("0.99") < sum);
+        CHECK(sum < real("1.01"));
+
+        // a sum added to itself contributes its operands
+        partial += partial;
+        CHECK(operation_of(partial)->operand_count() == 4);
+        CHECK(real("0.8") < partial);
+        CHECK(partial < real("0.9"));
+    }
+
+    SECTION("Refined sums enclose the exact value") {
+        real third = real("1") / real("3");
+        real sum = third;
+        for (int i = 0; i < 8; i++)
+            sum += third;
+
+        auto it = sum.get_real_itr().cbegin();
+        for (int i = 0; i < 10; i++)
+            ++it;
+
+        CHECK(real("2.999999") < sum);
+        CHECK(sum < real("3.000001"));
+    }
+
+    SECTION("Tapes and batches evaluate n-ary nodes") {
+        real x = real::placeholder(real("1"));
+        real sum = x;
+        real product = x;
+        for (int i = 1; i <= 4; i++) {
+            sum += real(std::to_string(i)) / seven;
+            product *= x;
+        }
+
+        boost::real::real_tape<TestType> tape = sum.compile();
+        auto it = sum.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+        for (int i = 0; i < 3; i++) {
+            ++tape;
+            ++it;
+            CHECK(tape.get_interval() == it.get_interval());
+        }
+
+        boost::real::real_batch<TestType> batch(product, {x});
+        batch.evaluate({{real("2"), real("-1")}});
+
+        // x^5
+        CHECK(batch.enclosure(0).lower <= 32);
+        CHECK(32 <= batch.enclosure(0).upper);
+        CHECK(batch.enclosure(1).lower <= -1);
+        CHECK(-1 <= batch.enclosure(1).upper);
+    }
+}
@@ -0,0 +1,65 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Hash-consing", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using table=boost::real::node_table<TestType>;
+
+    // the numbers share a node if their representations are the same object
+    auto same_node = [] (real a, real b) {
+        return &a.get_real_number() == &b.get_real_number();
+    };
+
+    SECTION("Disabled by default") {
+        real x("1.5");
+        CHECK_FALSE(same_node(real("3") * x, real("3") * x));
+    }
+
+    SECTION("Structurally identical trees are built once") {
+        table::enabled = true;
+
+        real x = real("1") / real("7");
+        real a = real("3") * x + real("1.5");
+        real b = real("3") * x + real("1.5");
+
+        CHECK(same_node(a, b));
+        CHECK(same_node(real("1.5"), real("1.5")));
+        CHECK_FALSE(same_node(real("1.5"), real("2.5")));
+        CHECK_FALSE(same_node(real("3") * x, x * real("3")));
+        CHECK_FALSE(same_node(real("3"), real("4")));
+        CHECK_FALSE(same_node(real("3") * x, real("3") + x));
+
+        // refining one of them refines the other
+        a.approximate(-3);
+        CHECK(a.get_real_itr().get_interval() == b.get_real_itr().get_interval());
+
+        table::enabled = false;
+    }
+
+    SECTION("Placeholders are never interned") {
+        table::enabled = true;
+
+        real x = real::placeholder(real("1"));
+        real y = real::placeholder(real("1"));
+        CHECK_FALSE(same_node(x, y));
+        CHECK(same_node(x * real("2"), x * real("2")));
+        CHECK_FALSE(same_node(x * real("2"), y * real("2")));
+
+        table::enabled = false;
+    }
+
+    SECTION("The table does not keep the nodes alive") {
+        table::enabled = true;
+
+        size_t before = table::size();
+        {
+            real a = real("1.5") / real("456") + real("789");
+            CHECK(table::size() == before + 5);
+        }
+        CHECK(table::size() == before);
+
+        table::enabled = false;
+    }
+}
@@ -0,0 +1,111 @@
+#include <catch2/catch.hpp>
+#include <real/parallel_evaluator.hpp>
+#include <test_helpers.hpp>
+
+#include <atomic>
+
+// sum of n products of divisions, wide enough to be split between the pool workers
+template <typename T>
+boost::real::real<T> wide_tree(int n) {
+    boost::real::real<T> sum("0");
+
+    for (int i = 1; i <= n; i++) {
+        boost::real::real<T> numerator(std::to_string(i));
+        boost::real::real<T> denominator(std::to_string(i + 2));
+        boost::real::real<T> factor(std::to_string(2 * i + 1));
+        sum += (numerator / denominator) * factor;
+    }
+
+    return sum;
+}
+
+TEST_CASE("Work stealing pool") {
+    boost::real::work_stealing_pool pool(4);
+
+    SECTION("Every index is visited once") {
+        std::vector<std::atomic<int>> visits(1000);
+        pool.parallel_for(visits.size(), 7, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++)
+                visits[i]++;
+        });
+
+        for (auto& visit : visits)
+            CHECK(visit == 1);
+    }
+
+    SECTION("Exceptions are propagated to the caller") {
+        CHECK_THROWS_AS(pool.parallel_for(100, 1, [](size_t begin, size_t end) {
+            if (begin == 50)
+                throw boost::real::precision_exception();
+        }), boost::real::precision_exception);
+    }
+
+    SECTION("A pool without workers runs inline") {
+        boost::real::work_stealing_pool inline_pool(0);
+        int visits = 0;
+        inline_pool.parallel_for(10, 1, [&](size_t begin, size_t end) {
+            visits += end - begin;
+        });
+
+        CHECK(visits == 10);
+    }
+}
+
+TEMPLATE_TEST_CASE("Parallel evaluation", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    boost::real::work_stealing_pool pool(4);
+
+    SECTION("Same intervals as the sequential evaluation") {
+        real parallel = wide_tree<TestType>(16);
+        real sequential = wide_tree<TestType>(16);
+        boost::real::parallel_evaluator<TestType> evaluator(pool, 4);
+
+        boost::real::const_precision_iterator<TestType> parallel_it = parallel.get_real_itr();
+        boost::real::const_precision_iterator<TestType> sequential_it = sequential.get_real_itr();
+
+        for (int i = 0; i < 5; i++) {
+            evaluator.iterate_n_times(parallel_it, 1);
+            ++sequential_it;
+
+            CHECK(parallel_it.get_interval() == sequential_it.get_interval());
+        }
+    }
+
+    SECTION("Shared subexpressions") {
+        auto shared_tree = [] () {
+            real a("1");
+            real b("7");
+            real x = a / b;
+            real y = wide_tree<TestType>(10) * x;
+            return y * y - x;
+        };
+        real parallel = shared_tree();
+        real sequential = shared_tree();
+        boost::real::parallel_evaluator<TestType> evaluator(pool, 1);
+
+        CHECK(evaluator.cend(parallel).get_interval() == sequential.get_real_itr().cend().get_interval());
+    }
+
+    SECTION("Small trees are evaluated inline") {
+        real a("1");
+        real b("3");
+        real x = a / b + b;
+        real y = a / b + b;
+        boost::real::parallel_evaluator<TestType> evaluator(pool);
+
+        CHECK(evaluator.cend(x).get_interval() == y.get_real_itr().cend().get_interval());
+    }
+
+    SECTION("Leaves and divisions by non positive numbers") {
+        real a("5");
+        real b("-3");
+        real x = wide_tree<TestType>(8) / b + a;
+        real y = wide_tree<TestType>(8) / b + a;
+        boost::real::parallel_evaluator<TestType> evaluator(pool, 1);
+
+        CHECK(evaluator.cend(x).get_interval() == y.get_real_itr().cend().get_interval());
+        CHECK(evaluator.cend(a).get_interval() == a.get_real_itr().cend().get_interval());
+    }
+}
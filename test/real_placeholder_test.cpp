@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Placeholders", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("The tree is evaluated for the bound number") {
+        real x = real::placeholder(real("1"));
+        real f = x * x + real("2");
+
+        CHECK(f == real("3"));
+
+        f.bind(x, real("3"));
+        CHECK(f == real("11"));
+
+        f.bind(x, real("-4"));
+        CHECK(f == real("18"));
+
+        f.bind(x, real("0.5"));
+        CHECK(f > real("2.24"));
+        CHECK(f < real("2.26"));
+    }
+
+    SECTION("Refined trees are evaluated again") {
+        real x = real::placeholder(real("1"));
+        real y = real::placeholder(real("2"));
+        real third = real("1") / real("3");
+        real f = (x + third) * y + x;
+
+        f.approximate(-3);
+        boost::real::interval<TestType> third_interval = third.get_real_itr().get_interval();
+
+        f.bind(y, real("3"));
+        CHECK(f.get_real_itr().cbegin().get_interval() == f.get_real_itr().get_interval());
+        CHECK(f > real("4.99"));
+        CHECK(f < real("5.01"));
+
+        // the nodes that do not depend on the placeholder keep their intervals
+        CHECK(third.get_real_itr().get_interval() == third_interval);
+
+        f.bind(x, real("2"));
+        CHECK(f > real("8.99"));
+        CHECK(f < real("9.01"));
+    }
+
+    SECTION("Placeholders bound to numbers with placeholders") {
+        real x = real::placeholder(real("1"));
+        real y = real::placeholder(x + real("1"));
+        real f = y * real("2");
+
+        CHECK(f == real("4"));
+
+        f.bind(x, real("5"));
+        CHECK(f == real("12"));
+        CHECK_THROWS_AS(f.bind(x, y), boost::real::invalid_representation_exception);
+    }
+
+    SECTION("Compiled trees") {
+        real x = real::placeholder(real("1"));
+        real f = x * real("7") - real("2");
+
+        f.bind(x, real("6"));
+        boost::real::real_tape<TestType> tape = f.compile();
+        auto it = f.get_real_itr().cbegin();
+        for (int i = 0; i < 3; i++) {
+            CHECK(tape.get_interval() == it.get_interval());
+            ++tape;
+            ++it;
+        }
+        CHECK(f == real("40"));
+    }
+
+    SECTION("Only placeholders are bound") {
+        real x = real::placeholder(real("1"));
+        real f = x + real("1");
+
+        CHECK_THROWS_AS(f.bind(f, real("2")), boost::real::bad_variant_access_exception);
+        CHECK_THROWS_AS(f.bind(x, f), boost::real::invalid_representation_exception);
+    }
+}
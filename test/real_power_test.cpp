@@ -0,0 +1,128 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <real/real_batch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Integer powers", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::OPERATION;
+
+    auto operation_of = [] (real x) {
+        return std::get_if<boost::real::real_operation<TestType>>(&x.get_real_number());
+    };
+
+    auto interval_of = [] (real x) {
+        auto it = x.get_real_itr().cbegin();
+        for (int i = 0; i < 4; i++)
+            ++it;
+        return it.get_interval();
+    };
+
+    real third = real("1") / real("3");
+
+    SECTION("A power is a single node") {
+        real x = pow(third, 10);
+        REQUIRE(operation_of(x) != nullptr);
+        CHECK(operation_of(x)->get_operation() == OPERATION::POWER);
+        CHECK(operation_of(x)->operand_count() == 1);
+        CHECK(operation_of(x)->exponent() == 10);
+
+        // identities are not built
+        CHECK(operation_of(pow(third, 1)) == operation_of(third));
+        CHECK(pow(third, 0) == real("1"));
+        CHECK(pow(real("1"), -7) == real("1"));
+        CHECK(pow(real("0"), 5) == real("0"));
+    }
+
+    SECTION("Powers of exact numbers") {
+        CHECK(pow(real("2"), 10) == real("1024"));
+        CHECK(pow(real("-3"), 3) == real("-27"));
+        CHECK(pow(real("-3"), 4) == real("81"));
+        CHECK(pow(real("1.5"), 2) == real("2.25"));
+        CHECK(pow(real("2"), -1) == real("0.5"));
+        CHECK(pow(real("-2"), -1) == real("-0.5"));
+    }
+
+    SECTION("Powers of intervals enclose the result") {
+        // (1/3)^5 = 0.004115226...
+        CHECK(real("0.0041152") < pow(third, 5));
+        CHECK(pow(third, 5) < real("0.0041153"));
+
+        // (-1/3)^3 = -0.037037...
+        real negative = real("0") - third;
+        CHECK(real("-0.037038") < pow(negative, 3));
+        CHECK(pow(negative, 3) < real("-0.037037"));
+        CHECK(real("0.012345") < pow(negative, 4));
+        CHECK(pow(negative, 4) < real("0.012346"));
+
+        // 3^-1 and (1/3)^-2
+        CHECK(real("0.33333") < pow(real("3"), -1));
+        CHECK(pow(real("3"), -1) < real("0.33334"));
+        CHECK(real("8.9999") < pow(third, -2));
+        CHECK(pow(third, -2) < real("9.0001"));
+    }
+
+    SECTION("Large powers of numbers below one are built quickly") {
+        // (1/3)^(2^25) is far below the maximum precision, its bounds are rounded to 0 and to
+        // base^-maximum_precision instead of being squared with ever more zero digits
+        real x = pow(third, 1L << 25);
+        boost::real::interval<TestType> bounds = interval_of(x);
+        boost::real::exact_number<TestType> zero;
+
+        CHECK(bounds.lower_bound == zero);
+        CHECK(zero < bounds.upper_bound);
+        CHECK(x < real("0.000001"));
+        CHECK(real("-0.000001") < pow(real("0") - third, (1L << 25) + 1));
+    }
+
+    SECTION("Negative powers of numbers below one are not rounded to zero") {
+        // 0.001^40 = 10^-120 is below base^-maximum_precision, but its bounds are inverted
+        real x = pow(real("0.001"), -40);
+        CHECK(real("1" + std::string(119, '0')) < x);
+        CHECK(x < real("1" + std::string(121, '0')));
+    }
+
+    SECTION("Even powers of intervals containing zero start at zero") {
+        // an interval around zero: 1/3 - 1/3 is not simplified
+        real tiny = third - real("1") / real("3");
+        boost::real::interval<TestType> even = interval_of(pow(tiny, 2));
+        boost::real::interval<TestType> odd = interval_of(pow(tiny, 3));
+        boost::real::exact_number<TestType> zero;
+
+        CHECK(even.lower_bound == zero);
+        CHECK(zero < even.upper_bound);
+        CHECK(odd.lower_bound < zero);
+        CHECK(zero < odd.upper_bound);
+    }
+
+    SECTION("Tapes and batches evaluate powers") {
+        real x = real::placeholder(real("1"));
+        real y = pow(x, 5) + pow(x, -2);
+
+        boost::real::real_tape<TestType> tape = y.compile();
+        auto it = y.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+        for (int i = 0; i < 3; i++) {
+            ++tape;
+            ++it;
+            CHECK(tape.get_interval() == it.get_interval());
+        }
+
+        boost::real::real_batch<TestType> batch(y, {x});
+        batch.evaluate({{real("2"), real("-1")}});
+
+        // 32 + 1/4 and -1 + 1
+        CHECK(batch.enclosure(0).lower <= 32.25);
+        CHECK(32.25 <= batch.enclosure(0).upper);
+        CHECK(batch.enclosure(1).lower <= 0);
+        CHECK(0 <= batch.enclosure(1).upper);
+    }
+
+    SECTION("Powers are interned") {
+        boost::real::node_table<TestType>::enabled = true;
+        CHECK(operation_of(pow(third, 3)) == operation_of(pow(third, 3)));
+        CHECK(operation_of(pow(third, 3)) != operation_of(pow(third, 4)));
+        boost::real::node_table<TestType>::enabled = false;
+    }
+}
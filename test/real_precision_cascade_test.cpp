@@ -0,0 +1,95 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+#include <string>
+
+TEST_CASE("Double-double intervals") {
+    using boost::real::double_double;
+    using boost::real::double_double_interval;
+
+    SECTION("Digits are exactly represented") {
+        long long digit = (1LL << 60) + 1;
+        double_double_interval x = double_double_interval::from_digit(digit);
+
+        CHECK(x.lower.hi == x.upper.hi);
+        CHECK(x.lower.lo == x.upper.lo);
+        CHECK(x.lower.lo == 1);
+    }
+
+    SECTION("Operations are rounded outwards") {
+        double_double_interval one(1, 1);
+        double_double_interval three(3, 3);
+        double_double_interval third = one / three;
+
+        CHECK(third.lower < third.upper);
+        CHECK((third * three).contains_zero() == false);
+        CHECK((third * three - one).contains_zero());
+
+        // a third is known far beyond the double precision
+        double_double width = third.upper - third.lower;
+        CHECK(width.hi < 1e-28);
+    }
+
+    SECTION("Undefined operations decide nothing") {
+        double_double_interval around_zero(-1, 1);
+        double_double_interval huge(1e300, 1e300);
+
+        CHECK(std::isinf((double_double_interval(1, 1) / around_zero).upper.hi));
+        CHECK(std::isinf((huge * huge).upper.hi));
+    }
+}
+
+TEST_CASE("Precision cascade") {
+
+    using real=boost::real::real<int>;
+
+    SECTION("Numbers closer than the double precision are compared without refining them") {
+        real ones(counted_ones, 0);
+        real x = ones + real("0.00000000000000000001");
+        int requests = digit_requests;
+
+        CHECK(ones < x);
+        CHECK(x > ones);
+        // only the leading digits of the double-double intervals, once
+        CHECK(digit_requests - requests <= 4);
+    }
+
+    SECTION("Numbers closer than the double-double precision are compared in fixed precision") {
+        real ones(counted_ones, 0);
+        real x = ones + real("0.0000000000000000000000000000000000000001");
+        int requests = digit_requests;
+
+        CHECK(ones < x);
+        // the leading digits of the double-double and the fixed precision intervals
+        CHECK(digit_requests - requests <= 4 + 8);
+    }
+
+    SECTION("Numbers closer than the fixed precision are refined") {
+        real ones(counted_ones, 0);
+        real x = ones + real("1e-75");
+        int requests = digit_requests;
+
+        CHECK(ones < x);
+        CHECK(digit_requests - requests > 4 + 8);
+    }
+}
+
+TEMPLATE_TEST_CASE("Cascaded comparisons", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("Every stage orders the numbers correctly") {
+        // closer and closer to a third, so each comparison needs more stages of the cascade
+        real third = real("1") / real("3");
+        real close_third("0." + std::string(20, '3'));
+        real closer_third("0." + std::string(42, '3'));
+        real closest_third("0." + std::string(80, '3'));
+
+        CHECK(close_third < third);
+        CHECK(third > closer_third);
+        CHECK(closest_third < third);
+        CHECK(close_third < closer_third);
+        CHECK(closer_third < closest_third);
+    }
+}
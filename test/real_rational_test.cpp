@@ -0,0 +1,87 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Rational numbers", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using rational=boost::real::real_rational<TestType>;
+
+    auto integer = [] (const std::string& digits) {
+        return boost::real::real_explicit<TestType>(digits).get_exact_number();
+    };
+
+    auto rational_of = [] (real a) {
+        return std::get<rational>(a.get_real_number());
+    };
+
+    SECTION("Decimal literals are rational numbers") {
+        real x("1.5");
+        REQUIRE(std::holds_alternative<rational>(x.get_real_number()));
+
+        // 15 / 10 in lowest terms
+        CHECK(rational_of(x).numerator() == integer("3"));
+        CHECK(rational_of(x).denominator() == integer("2"));
+
+        rational unreduced(integer("15"), integer("10"), false);
+        CHECK(unreduced.numerator() == integer("15"));
+        CHECK(unreduced.denominator() == integer("10"));
+
+        CHECK(rational_of(real("-0.125")).numerator() == integer("-1"));
+        CHECK(rational_of(real("-0.125")).denominator() == integer("8"));
+        CHECK(rational_of(real("12.5e-3")).denominator() == integer("80"));
+
+        // zeros next to the point
+        CHECK(rational_of(real("3.000001")).numerator() == integer("3000001"));
+        CHECK(rational_of(real("30.5")).numerator() == integer("61"));
+        CHECK(rational_of(real("-20.02")).numerator() == integer("-1001"));
+        CHECK(rational_of(real("-20.02")).denominator() == integer("50"));
+    }
+
+    SECTION("The intervals enclose the number and shrink") {
+        real x("0.3");
+        auto it = x.get_real_itr().cbegin();
+        boost::real::interval<TestType> previous = it.get_interval();
+
+        for (int i = 0; i < 6; i++) {
+            ++it;
+            const boost::real::interval<TestType>& current = it.get_interval();
+            CHECK(previous.lower_bound <= current.lower_bound);
+            CHECK(current.upper_bound <= previous.upper_bound);
+            CHECK(current.lower_bound < current.upper_bound);
+            previous = current;
+        }
+
+        CHECK(real("0.29999999") < x);
+        CHECK(x < real("0.30000001"));
+        CHECK(real("-0.30000001") < real("-0.3"));
+        CHECK(real("-0.3") < real("-0.29999999"));
+    }
+
+    SECTION("Digits are calculated once and shared by the copies") {
+        rational third_of_three(integer("1"), integer("3"));
+        rational copy = third_of_three;
+
+        TestType digit = third_of_three[5];
+        CHECK(copy[5] == digit);
+        CHECK(copy.leading_digits(6) == third_of_three.leading_digits(6));
+        CHECK_FALSE(copy.exact_within(100));
+    }
+
+    SECTION("Finite expansions become exact") {
+        // 1 / 2 ends after the first digit in the even internal base
+        real half("0.5");
+        auto it = half.get_real_itr().cbegin();
+        ++it;
+        CHECK(it.get_interval().is_a_number());
+        CHECK(rational_of(half).exact_within(1));
+    }
+
+    SECTION("Rational numbers are compared exactly") {
+        CHECK(real("0.1") + real("0.2") == real("0.3"));
+        CHECK(real("0.1") * real("0.1") == real("0.01"));
+        CHECK(real("1.1") - real("0.1") == real("1"));
+        CHECK(real("0.3333333") < real("1") / real("3"));
+        CHECK(real("2.5") * real("-0.4") == real("-1"));
+    }
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch.hpp>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Rebalancing of operation runs", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using node=std::shared_ptr<boost::real::real_data<TestType>>;
+
+    // depth of the operation tree, walked with an explicit stack
+    auto depth = [] (real x) {
+        size_t result = 0;
+        std::vector<std::pair<const boost::real::real_number<TestType>*, size_t>> pending = {{&x.get_real_number(), 1}};
+
+        while (!pending.empty()) {
+            auto [number, level] = pending.back();
+            pending.pop_back();
+            result = std::max(result, level);
+
+            if (auto operation = std::get_if<boost::real::real_operation<TestType>>(number)) {
+                for (size_t i = 0; i < operation->operand_count(); i++) {
+                    node operand = operation->operand(i);
+                    pending.push_back({&operand->get_real_number(), level + 1});
+                }
+            }
+        }
+
+        return result;
+    };
+
+    real seven("7");
+
+    SECTION("Accumulated sums are kept balanced") {
+        real sum = real("1") / seven;
+        for (int i = 2; i <= 1000; i++)
+            sum = sum + real(std::to_string(i)) / seven;
+
+        // 1000 divisions below a run of logarithmic depth
+        CHECK(depth(sum) <= 24);
+
+        // 500500 / 7 = 71500
+        CHECK(real("71499") < sum);
+        CHECK(sum < real("71501"));
+    }
+
+    SECTION("Binary operators are balanced too") {
+        real product = real("2") / real("1");
+        for (int i = 2; i <= 64; i++)
+            product = product * (real(std::to_string(i + 1)) / real(std::to_string(i)));
+
+        CHECK(depth(product) <= 10);
+
+        // the product telescopes to 65
+        CHECK(real("64") < product);
+        CHECK(product < real("66"));
+    }
+
+    SECTION("Other operations break the runs") {
+        real x = real("1") / seven;
+        real result = x;
+        for (int i = 0; i < 16; i++) {
+            result += real("1") / seven;
+            result -= x;
+        }
+
+        // subtractions are not associative, every one of them adds a level
+        CHECK(depth(result) >= 16);
+        CHECK(real("-1") < result);
+        CHECK(result < real("1"));
+    }
+
+    SECTION("The replaced nodes are not modified") {
+        real sum = real("1") / seven;
+        sum += real("2") / seven;
+        sum += real("3") / seven;
+
+        real partial = sum;
+        const boost::real::real_number<TestType>* partial_node = &partial.get_real_number();
+        sum += real("4") / seven;
+
+        CHECK(&partial.get_real_number() == partial_node);
+        CHECK(real("0") < partial);
+        CHECK(partial < real("1"));
+        CHECK(real("1") < sum);
+        CHECK(sum < real("2"));
+    }
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Reciprocal cache", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using cache=boost::real::reciprocal_cache<TestType>;
+    using exact_number=boost::real::exact_number<TestType>;
+
+    auto integer = [] (const std::string& digits) {
+        return boost::real::real_explicit<TestType>(digits).get_exact_number();
+    };
+
+    SECTION("Reciprocals enclose the exact value") {
+        for (std::string digits : {"3", "7", "-12", "1000000000000000000000000000001"}) {
+            exact_number d = integer(digits);
+            exact_number one(std::vector<TestType>{1}, 1);
+
+            for (size_t precision : {1, 4, 9, 20}) {
+                boost::real::interval<TestType> reciprocal = cache::reciprocal(d, precision);
+                CHECK(reciprocal.lower_bound <= reciprocal.upper_bound);
+                CHECK(reciprocal.lower_bound.positive == d.positive);
+
+                // d times the bounds encloses one
+                exact_number lower = reciprocal.lower_bound * d;
+                exact_number upper = reciprocal.upper_bound * d;
+                lower.normalize();
+                upper.normalize();
+                CHECK(std::min(lower, upper) <= one);
+                CHECK(one <= std::max(lower, upper));
+            }
+        }
+
+        // a finite expansion is exact
+        boost::real::interval<TestType> half = cache::reciprocal(integer("2"), 5);
+        CHECK(half.is_a_number());
+        CHECK(half.lower_bound.as_string() == "0.5");
+
+        CHECK_THROWS_AS(cache::reciprocal(exact_number(), 5), boost::real::divide_by_zero);
+        cache::clear();
+    }
+
+    SECTION("Quotients by exact divisors share the reciprocal") {
+        cache::enabled = true;
+        cache::clear();
+
+        real third = real("1") / real("3");
+        real sevenths = real("22") / real("7") + real("1") / real("-7");
+        CHECK(real("0.333333") < third);
+        CHECK(third < real("0.333334"));
+        CHECK(real("2.999999") < sevenths);
+        CHECK(sevenths < real("3.000001"));
+
+        // 3 and 7, 7 and -7 share the entry
+        CHECK(cache::size() == 2);
+
+        // exact quotients are numbers
+        auto it = (real("690") / real("2")).get_real_itr().cbegin();
+        CHECK(it.get_interval().lower_bound.as_string() == "345");
+        CHECK(it.get_interval().is_a_number());
+
+        cache::enabled = false;
+        cache::clear();
+    }
+
+    SECTION("Quotients of intervals enclose the result and shrink") {
+        cache::enabled = true;
+
+        real x = (real("1") / real("3")) / real("-7");
+        auto it = x.get_real_itr().cbegin();
+        boost::real::interval<TestType> previous = it.get_interval();
+        for (int i = 0; i < 5; i++) {
+            ++it;
+            const boost::real::interval<TestType>& current = it.get_interval();
+            CHECK(previous.lower_bound <= current.lower_bound);
+            CHECK(current.upper_bound <= previous.upper_bound);
+            previous = current;
+        }
+
+        // -1 / 21 = -0.047619...
+        CHECK(real("-0.04762") < x);
+        CHECK(x < real("-0.04761"));
+
+        cache::enabled = false;
+        cache::clear();
+    }
+}
@@ -0,0 +1,68 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Compiled evaluation tape", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+
+    SECTION("A leaf is a single instruction") {
+        real a("123456789012345678901234567890");
+        boost::real::real_tape<TestType> tape = a.compile();
+
+        CHECK(tape.size() == 1);
+        CHECK(tape.get_interval() == a.get_real_itr().cbegin().get_interval());
+    }
+
+    SECTION("Shared operands are compiled once") {
+        real a = real("3") / real("2");
+        real b = real("-9") / real("4");
+        real c = a * b;
+        real d = c + c * a - b;
+
+        // a and b are divisions of two explicit numbers, 6 nodes, plus c, c * a, the sum and d
+        CHECK(d.compile().size() == 10);
+    }
+
+    SECTION("Same intervals as the precision iterator") {
+        real a("1");
+        real b("3");
+        real c("-0.7");
+        real x = (a / b + c) * (a - c / b) - a / (b + c);
+
+        boost::real::real_tape<TestType> tape = x.compile();
+        auto it = x.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+
+        for (int i = 0; i < 5; i++) {
+            ++tape;
+            ++it;
+            CHECK(tape.precision() == (size_t) i + 2);
+            CHECK(tape.get_interval() == it.get_interval());
+        }
+
+        tape.iterate_n_times(3);
+        it.iterate_n_times(3);
+        CHECK(tape.get_interval() == it.get_interval());
+    }
+
+    SECTION("Negative divisors are not refined further") {
+        real a("1");
+        real b("3");
+        real x = a / (a / b - a);
+
+        boost::real::real_tape<TestType> tape = x.compile();
+        auto it = x.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+        CHECK(tape.get_interval().negative());
+    }
+
+    SECTION("Divisors containing zero are refined until they do not") {
+        real tiny("0.000000000000000000000000000000000000000001");
+        real x = real("1") / tiny;
+        boost::real::real_tape<TestType> tape = x.compile();
+
+        CHECK(tape.get_interval().positive());
+        CHECK_THROWS_AS((real("1") / (tiny - real::placeholder(real("1e-42")))).compile(), boost::real::divergent_division_result_exception);
+    }
+}
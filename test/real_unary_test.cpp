@@ -0,0 +1,147 @@
+#include <catch2/catch.hpp>
+#include <real/real.hpp>
+#include <real/real_batch.hpp>
+#include <test_helpers.hpp>
+
+TEMPLATE_TEST_CASE("Negation, absolute value and scaling", "[template]", int, long, long long) {
+
+    using real=boost::real::real<TestType>;
+    using boost::real::OPERATION;
+
+    auto operation_of = [] (real x) {
+        return std::get_if<boost::real::real_operation<TestType>>(&x.get_real_number());
+    };
+
+    auto interval_of = [] (real x) {
+        auto it = x.get_real_itr().cbegin();
+        for (int i = 0; i < 4; i++)
+            ++it;
+        return it.get_interval();
+    };
+
+    // the internal base, which scale multiplies by
+    real base(std::to_string((std::numeric_limits<TestType>::max() / 4) * 2));
+    real third = real("1") / real("3");
+
+    SECTION("Unary operations are single nodes") {
+        REQUIRE(operation_of(-third) != nullptr);
+        CHECK(operation_of(-third)->get_operation() == OPERATION::NEGATE);
+        CHECK(operation_of(-third)->operand_count() == 1);
+        CHECK(operation_of(abs(third))->get_operation() == OPERATION::ABS);
+        CHECK(operation_of(scale(third, 2))->get_operation() == OPERATION::SCALE);
+        CHECK(operation_of(scale(third, 2))->exponent() == 2);
+
+        // chains collapse
+        CHECK(operation_of(-(-third)) == operation_of(third));
+        CHECK(operation_of(abs(-third))->lhs() == operation_of(abs(third))->lhs());
+        CHECK(operation_of(scale(scale(third, 2), -1))->exponent() == 1);
+        CHECK(operation_of(scale(scale(third, 2), -2)) == operation_of(third));
+    }
+
+    SECTION("Scalings out of the range of the exponents are rejected") {
+        long half = std::numeric_limits<typename boost::real::exact_number<TestType>::exponent_t>::max() / 2;
+        CHECK_THROWS_AS(scale(third, half + 1), boost::real::exponent_overflow_exception);
+        CHECK_THROWS_AS(scale(third, -half - 2), boost::real::exponent_overflow_exception);
+
+        // the exponents of a collapsed chain are added, the sum is checked too
+        real scaled = scale(scale(third, half), -half);
+        CHECK(operation_of(scaled) == operation_of(third));
+        CHECK_THROWS_AS(scale(scale(third, half), half), boost::real::exponent_overflow_exception);
+        CHECK_THROWS_AS(scale(scale(scale(third, half), half), half), boost::real::exponent_overflow_exception);
+    }
+
+    SECTION("Exact numbers are transformed exactly") {
+        CHECK(operation_of(-real("1.5")) == nullptr);
+        CHECK(-real("1.5") == real("-1.5"));
+        CHECK(-real("-7") == real("7"));
+        CHECK(-real("0") == real("0"));
+        CHECK(abs(real("-2.25")) == real("2.25"));
+        CHECK(abs(real("3")) == real("3"));
+        CHECK(scale(real("3"), 1) == real("3") * base);
+        CHECK(scale(real("0.5"), 2) == real("0.5") * base * base);
+        CHECK(scale(real("3"), -1) * base == real("3"));
+    }
+
+    SECTION("Scaled integers are reduced to lowest terms") {
+        // 2 * base / base is the explicit integer 2
+        TestType twice_base = 4 * (std::numeric_limits<TestType>::max() / 4);
+        real two = scale(real(std::to_string(twice_base)), -1);
+        CHECK(std::get_if<boost::real::real_explicit<TestType>>(&two.get_real_number()) != nullptr);
+        CHECK(two == real("2"));
+
+        boost::real::node_table<TestType>::enabled = true;
+        CHECK(&scale(real(std::to_string(twice_base)), -1).get_real_number() == &real("2").get_real_number());
+        boost::real::node_table<TestType>::enabled = false;
+    }
+
+    SECTION("The intervals of the operand are transformed") {
+        // -1/3, |-1/3| and |1/3 - 1/2| = 1/6
+        CHECK(real("-0.33334") < -third);
+        CHECK(-third < real("-0.33333"));
+        CHECK(real("0.33333") < abs(real("0") - third));
+        CHECK(abs(real("0") - third) < real("0.33334"));
+        CHECK(real("0.16666") < abs(third - real("1") / real("2")));
+        CHECK(abs(third - real("1") / real("2")) < real("0.16667"));
+
+        auto normalized = [] (boost::real::exact_number<TestType> x) {
+            x.normalize_left();
+            return x;
+        };
+
+        boost::real::interval<TestType> operand = interval_of(third);
+        boost::real::interval<TestType> negated = interval_of(-third);
+        CHECK(normalized(negated.lower_bound).digits == normalized(operand.upper_bound).digits);
+        CHECK(normalized(negated.upper_bound).digits == normalized(operand.lower_bound).digits);
+        CHECK_FALSE(negated.lower_bound.positive);
+        CHECK_FALSE(negated.upper_bound.positive);
+
+        boost::real::interval<TestType> scaled = interval_of(scale(third, 3));
+        CHECK(normalized(scaled.lower_bound).exponent == normalized(operand.lower_bound).exponent + 3);
+        CHECK(normalized(scaled.lower_bound).digits == normalized(operand.lower_bound).digits);
+        CHECK(normalized(scaled.upper_bound).digits == normalized(operand.upper_bound).digits);
+
+        CHECK(scale(third, 1) < base / real("3") + real("1"));
+        CHECK(base / real("3") - real("1") < scale(third, 1));
+    }
+
+    SECTION("Absolute values of intervals containing zero start at zero") {
+        // an interval around zero: 1/3 - 1/3 is not simplified
+        real tiny = third - real("1") / real("3");
+        boost::real::interval<TestType> folded = interval_of(abs(tiny));
+        boost::real::exact_number<TestType> zero;
+
+        CHECK(folded.lower_bound == zero);
+        CHECK(zero < folded.upper_bound);
+    }
+
+    SECTION("Tapes and batches evaluate unary operations") {
+        real x = real::placeholder(real("1"));
+        real y = abs(-x * third) + scale(x, -1) - (-x);
+
+        boost::real::real_tape<TestType> tape = y.compile();
+        auto it = y.get_real_itr().cbegin();
+        CHECK(tape.get_interval() == it.get_interval());
+        for (int i = 0; i < 3; i++) {
+            ++tape;
+            ++it;
+            CHECK(tape.get_interval() == it.get_interval());
+        }
+
+        boost::real::real_batch<TestType> batch(y, {x});
+        batch.evaluate({{real("3"), real("-3")}});
+
+        // 1 + 3 / base + 3 and 1 - 3 / base - 3
+        CHECK(batch.enclosure(0).lower <= 4.00001);
+        CHECK(4 <= batch.enclosure(0).upper);
+        CHECK(batch.enclosure(1).lower <= -2);
+        CHECK(-2.00001 <= batch.enclosure(1).upper);
+    }
+
+    SECTION("Unary operations are interned") {
+        boost::real::node_table<TestType>::enabled = true;
+        CHECK(operation_of(-third) == operation_of(-third));
+        CHECK(operation_of(scale(third, 1)) == operation_of(scale(third, 1)));
+        CHECK(operation_of(scale(third, 1)) != operation_of(scale(third, 2)));
+        boost::real::node_table<TestType>::enabled = false;
+    }
+}